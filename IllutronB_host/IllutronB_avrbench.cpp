@@ -0,0 +1,193 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// IllutronB AVR cycle counts under simavr
+//
+// IllutronB_bench times the render core on a PC, which tells us whether a change is faster or slower but not how many
+// of the Arduino's 2000 cycles per sample it uses. This is a tiny AVR program which runs the real backend - the timer
+// interrupt and fillBuffer - with ILLUTRONB_PROFILE turned on and prints the cycle counts, and rather than flash it to
+// a board we run it on simavr (https://github.com/buserror/simavr), which simulates an ATmega328 cycle by cycle.
+// The same build on the same simavr gives exactly the same numbers every time, so they can be compared between releases.
+//
+// Build from this folder with -
+//
+//   avr-g++ -Os -mmcu=atmega328p -DF_CPU=16000000UL -DILLUTRONB_PROFILE -I../IllutronB_toby_rev2_v08_4 -o IllutronB_avrbench.elf IllutronB_avrbench.cpp ../IllutronB_toby_rev2_v08_4/IllutronB.cpp ../IllutronB_toby_rev2_v08_4/IllutronB_avr.cpp
+//
+// and run with -
+//
+//   simavr -m atmega328p -f 16000000 IllutronB_avrbench.elf
+//
+// simavr prints what the program writes to the serial port, one line per case -
+//
+//   case  ISR cycles min/average/max  render cycles per sample min/average/max  CPU %
+//
+// and exits when the program has finished. The cases are each output mode with all of the voices silent and then with
+// all of them sounding a note from a one second preset, each rendered for BENCH_BLOCKS blocks after a block to settle.
+// Each voice's commands are given a block to reach render before the next voice's are queued so that the command queue
+// never has to hold a whole case, and a sounding case checks that every voice really is playing before it measures -
+// if a command was dropped or a voice is silent the case prints "FAILED" and which voice instead of the cycle counts,
+// since numbers for fewer voices than CHANNEL_MAX would look like a speed up.
+// The cycle counts come from timer 1 so they are in steps of 8 cycles, see ILLUTRONB_PROFILE in IllutronB.h. The same
+// program flashed to a real Arduino prints the same lines at 9600 baud.
+//
+// There is no baseline recorded here yet - avr-gcc and simavr were not available where this was written, so it has
+// only been checked to compile against the AVR headers. The lines from the first real run belong here so that later
+// runs have something to be compared with.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#include "IllutronB.h"
+
+#include "sin256.h"
+#include "ramp256.h"
+#include "noise256.h"
+#include "tria256.h"
+
+#include "env0.h"
+#include "env1.h"
+#include "env2.h"
+#include "env3.h"
+
+#include "Presets.h"
+
+#if !defined(ILLUTRONB_PROFILE)
+#error build IllutronB_avrbench with -DILLUTRONB_PROFILE, the cycle counts come from the backend profiling
+#endif
+
+#define BENCH_BLOCKS 32          // blocks rendered for each case
+#define BENCH_BLOCK_SAMPLES 64   // the size of a block rendered by fillBuffer, FIFO_BLOCK_SIZE in IllutronB_avr.cpp
+#define BENCH_BAUD 9600
+
+// the serial port without the Arduino core, simavr shows anything written to UDR0
+static void putChar(char c)
+{
+  while(!(UCSR0A & (1<<UDRE0)))
+  {
+  }
+  UCSR0A |= (1<<TXC0);   // writing 1 clears the transmit complete flag, it is set again once this character is out
+  UDR0 = c;
+}
+
+static void putString(const char *pString)
+{
+  while(*pString)
+  {
+    putChar(*pString++);
+  }
+}
+
+static void putNumber(uint16_t unNumber)
+{
+  char digits[6];
+  uint8_t sDigits = 0;
+  do
+  {
+    digits[sDigits++] = '0' + (unNumber % 10);
+    unNumber /= 10;
+  } while(unNumber);
+  while(sDigits)
+  {
+    putChar(digits[--sDigits]);
+  }
+}
+
+static void putCycles(const CIllutronB::SCycles &cycles)
+{
+  putNumber(cycles.unMin);
+  putChar('/');
+  putNumber(cycles.unAverage);
+  putChar('/');
+  putNumber(cycles.unMax);
+}
+
+// keep fillBuffer topping up the FIFO until the interrupt has played this many more blocks
+static void renderBlocks(uint8_t sBlocks)
+{
+  uint32_t ulEnd = IllutronB.getSampleTime() + ((uint32_t)sBlocks * BENCH_BLOCK_SAMPLES);
+  while((int32_t)(IllutronB.getSampleTime() - ulEnd) < 0)
+  {
+    IllutronB.fillBuffer();
+  }
+}
+
+static void putFailed(const char *pName,uint8_t sVoice)
+{
+  putString(pName);
+  putString("  FAILED voice ");
+  putNumber(sVoice);
+  putString("\r\n");
+}
+
+static void runCase(const char *pName,uint8_t sOutputMode,bool bSounding)
+{
+  if(!IllutronB.setOutputMode(sOutputMode))
+  {
+    putFailed(pName,0);
+    return;
+  }
+  for(uint8_t sVoice = 0;sVoice < CHANNEL_MAX;sVoice++)
+  {
+    // a different pan for each voice so that pan mode does the full sum for every one of them
+    bool bQueued = IllutronB.m_Voices[sVoice].setPan((CHANNEL_MAX > 1) ? (sVoice * 255) / (CHANNEL_MAX - 1) : 128);
+    if(bSounding)
+    {
+      // one second envelopes, longer than the case so the voices sound all the way through
+      bQueued = bQueued && IllutronB.m_Voices[sVoice].setPreset(&sPresets[PRESET_SIN_LONG]);
+      bQueued = bQueued && IllutronB.m_Voices[sVoice].triggerMidi(48 + (sVoice * 7));
+    }
+
+    // one block for this voice's commands to reach render and empty the queue before the next voice
+    renderBlocks(1);
+
+    // the envelopes start at full volume, so a voice that was triggered has an amplitude after its first block
+    if(!bQueued || (bSounding && (0 == IllutronB.m_Voices[sVoice].getAmplitude())))
+    {
+      putFailed(pName,sVoice);
+      return;
+    }
+  }
+
+  CIllutronB::resetProfile();
+  renderBlocks(BENCH_BLOCKS);
+
+  CIllutronB::SCycles isrCycles,renderCycles;
+  CIllutronB::getISRCycles(isrCycles);
+  CIllutronB::getRenderCycles(renderCycles);
+  putString(pName);
+  putString("  ISR ");
+  putCycles(isrCycles);
+  putString("  render ");
+  putCycles(renderCycles);
+  putString("  CPU ");
+  putNumber(CIllutronB::getCPULoad());
+  putString("%\r\n");
+}
+
+int main()
+{
+  UBRR0 = (F_CPU/16/BENCH_BAUD) - 1;
+  UCSR0B = (1<<TXEN0);
+
+  IllutronB.setBPM(120);
+  IllutronB.initSynth();
+
+  // the voices are silent until they are first triggered, so all of the silent cases go first
+  runCase("mono-silent   ",CIllutronB::OUTPUT_MONO,false);
+  runCase("split-silent  ",CIllutronB::OUTPUT_SPLIT,false);
+  runCase("pan-silent    ",CIllutronB::OUTPUT_PAN,false);
+  runCase("mono-active   ",CIllutronB::OUTPUT_MONO,true);
+  runCase("split-active  ",CIllutronB::OUTPUT_SPLIT,true);
+  runCase("pan-active    ",CIllutronB::OUTPUT_PAN,true);
+
+  // let the last character out of the serial port, then sleep with interrupts off which tells simavr we are done
+  while(!(UCSR0A & (1<<TXC0)))
+  {
+  }
+  cli();
+  sleep_enable();
+  sleep_cpu();
+  return 0;
+}
@@ -0,0 +1,366 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// IllutronB benchmarks
+//
+// Times the render core on a PC so we can see whether a change has made it faster or slower. Each case renders
+// the same sound over and over for a fixed time and reports the best of several runs as nanoseconds per sample and
+// samples per second - the best run is the one least disturbed by whatever else the PC was doing.
+//
+// Build from this folder with -
+//
+//   g++ -O2 -I../IllutronB_toby_rev2_v08_4 -o IllutronB_bench IllutronB_bench.cpp ../IllutronB_toby_rev2_v08_4/IllutronB.cpp
+//
+// add -DCHANNEL_MAX=16 to see how the mix scales with more voices, CHANNEL_MAX must be a multiple of four here.
+//
+// and run with -
+//
+//   ./IllutronB_bench            - run every case
+//   ./IllutronB_bench voice      - run only the cases with 'voice' in the name
+//   ./IllutronB_bench -t 1000    - run each case for 1000ms rather than the default 200ms
+//
+// The cases -
+//
+//   voice-silent       one voice with an amplitude of 0, the early out which skips calculating the samples
+//   voice-active       one voice sounding, rendered in runs which never reach an envelope update
+//   voice-envelope     one voice sounding, with an envelope update on every sample - the worst case for the envelope
+//   voice-block        one voice sounding, rendered in blocks of RENDER_BLOCK_MAX with an envelope update every ENVELOPE_DIVIDER+1 samples
+//   voice-interpolated as voice-block with wave table interpolation turned on, the difference is the cost of interpolating
+//   voice-adsr         as voice-block with an ADSR envelope rather than an envelope table
+//   mix-silent         synth.render with all of the voices silent
+//   mix-active         synth.render with all of the voices sounding all of the time
+//   mix-sequence       synth.render playing the amen sequence at 120 BPM, a realistic mix of sounding and silent voices
+//
+// A PC is a very different machine from an ATmega328 so compare these numbers with each other and with earlier
+// builds, not with the Arduino. For AVR cycle counts without a board run IllutronB_avrbench.cpp on the simavr
+// simulator, see the build and run commands at the top of that file.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "IllutronB.h"
+
+#include "sin256.h"
+#include "ramp256.h"
+#include "noise256.h"
+#include "tria256.h"
+
+#include "env0.h"
+#include "env1.h"
+#include "env2.h"
+#include "env3.h"
+
+#include "AmenBreak.h"
+
+// the number of times each case is run, we report the fastest
+#define BENCH_RUNS 5
+
+#if (CHANNEL_MAX < 4) || (CHANNEL_MAX % 4)
+#error the benchmarks need a multiple of four voices
+#endif
+
+// the synth the cases play through
+static CIllutronB synth;
+
+// the voices from setup() in the demo sketch, a build with more voices repeats them
+// The setups go through the command queue which only has room for a few at a time, we are not rendering yet so
+// apply each group ourselves rather than waiting for render to do it.
+static void setupVoices()
+{
+  for(uint8_t sVoice = 0;sVoice < CHANNEL_MAX;sVoice += 4)
+  {
+    synth.m_Voices[sVoice].setup((uintptr_t)SinTable,200.0,(uintptr_t)Env0,0.4,300);
+    synth.m_Voices[sVoice+1].setup((uintptr_t)RampTable,100.0,(uintptr_t)Env1,1.0,512);
+    synth.m_Voices[sVoice+2].setup((uintptr_t)TriangleTable,100.0,(uintptr_t)Env2,.5,1000);
+    synth.m_Voices[sVoice+3].setup((uintptr_t)NoiseTable,1200.0,(uintptr_t)Env3,.04,500);
+    synth.syncVoices();
+  }
+}
+
+// Each case sets itself up and then renders one 'pass' of RENDER_BLOCK_MAX samples at a time, returning the number
+// of samples it rendered. The output goes to a sink so that the compiler cannot throw the work away.
+static volatile int32_t nSink;
+
+static int16_t nMix[RENDER_BLOCK_MAX];
+static int8_t sOut[RENDER_BLOCK_MAX];
+
+static void sinkMix()
+{
+  int32_t nTotal = 0;
+  for(uint8_t sIndex = 0;sIndex < RENDER_BLOCK_MAX;sIndex++)
+  {
+    nTotal += nMix[sIndex];
+  }
+  nSink = nTotal;
+}
+
+static void sinkOut()
+{
+  int32_t nTotal = 0;
+  for(uint8_t sIndex = 0;sIndex < RENDER_BLOCK_MAX;sIndex++)
+  {
+    nTotal += sOut[sIndex];
+  }
+  nSink = nTotal;
+}
+
+static void setupVoiceSilent()
+{
+  synth.reset();
+  synth.m_Voices[0].setup((uintptr_t)SinTable,200.0,(uintptr_t)Env0,0.5,512);
+  synth.syncVoices();
+}
+
+static uint32_t passVoiceSilent()
+{
+  synth.renderVoice(0,nMix,NULL,RENDER_BLOCK_MAX,0);
+  sinkMix();
+  return RENDER_BLOCK_MAX;
+}
+
+static void setupVoiceActive()
+{
+  synth.reset();
+  synth.m_Voices[0].setup((uintptr_t)SinTable,200.0,(uintptr_t)Env1,1.0,512);
+  synth.m_Voices[0].triggerMidi(60);
+  synth.syncVoices();
+  // one envelope update to pick up the first amplitude, after that we render runs which stop short of the next update
+  synth.renderVoice(0,nMix,NULL,1,0);
+}
+
+static uint32_t passVoiceActive()
+{
+  for(uint8_t sIndex = 0;sIndex < RENDER_BLOCK_MAX;sIndex += ENVELOPE_DIVIDER)
+  {
+    synth.renderVoice(0,&nMix[sIndex],NULL,ENVELOPE_DIVIDER,ENVELOPE_DIVIDER);
+  }
+  sinkMix();
+  return RENDER_BLOCK_MAX;
+}
+
+static void setupVoiceEnvelope()
+{
+  synth.reset();
+  synth.m_Voices[0].setup((uintptr_t)SinTable,200.0,(uintptr_t)Env1,1.0,512);
+}
+
+static uint32_t passVoiceEnvelope()
+{
+  // retrigger every pass so the envelope never reaches the end and drops to the silent early out
+  synth.m_Voices[0].triggerMidi(60);
+  synth.syncVoices();
+  for(uint8_t sIndex = 0;sIndex < RENDER_BLOCK_MAX;sIndex++)
+  {
+    synth.renderVoice(0,&nMix[sIndex],NULL,1,0);
+  }
+  sinkMix();
+  return RENDER_BLOCK_MAX;
+}
+
+static uint32_t passVoiceBlock()
+{
+  synth.m_Voices[0].triggerMidi(60);
+  synth.syncVoices();
+  synth.renderVoice(0,nMix,NULL,RENDER_BLOCK_MAX,ENVELOPE_DIVIDER);
+  sinkMix();
+  return RENDER_BLOCK_MAX;
+}
+
+static void setupVoiceInterpolated()
+{
+  setupVoiceEnvelope();
+  synth.m_Voices[0].setInterpolation(true);
+}
+
+static void setupVoiceADSR()
+{
+  synth.reset();
+  synth.m_Voices[0].setup((uintptr_t)SinTable,200.0,0,1.0,512);
+  // a long sustain, the note never finishes
+  synth.m_Voices[0].setADSR(0.01,0.5,200,0.5);
+}
+
+static void setupMixSilent()
+{
+  synth.reset();
+  setupVoices();
+}
+
+static uint32_t passMix()
+{
+  synth.render(sOut,RENDER_BLOCK_MAX);
+  sinkOut();
+  return RENDER_BLOCK_MAX;
+}
+
+static uint32_t passMixActive()
+{
+  for(uint8_t sVoice = 0;sVoice < CHANNEL_MAX;sVoice += 4)
+  {
+    synth.m_Voices[sVoice].trigger();
+    synth.m_Voices[sVoice+1].triggerMidi(48);
+    synth.m_Voices[sVoice+2].triggerMidi(60);
+    synth.m_Voices[sVoice+3].trigger();
+  }
+  return passMix();
+}
+
+static void setupMixSequence()
+{
+  synth.reset();
+  setupVoices();
+  synth.setBPM(120);
+}
+
+// As the demo sketch, render up to the end of the beat then play the next step of the sequence
+static unsigned char sSequenceStep;
+
+static uint32_t passMixSequence()
+{
+  size_t unFrames = synth.getSamplesToBeat();
+  if(unFrames > RENDER_BLOCK_MAX)
+  {
+    unFrames = RENDER_BLOCK_MAX;
+  }
+  synth.render(sOut,unFrames);
+  sinkOut();
+
+  if(synth.beatComplete())
+  {
+    if(amenSequence.getTrigger(0,sSequenceStep))
+    {
+      synth.m_Voices[CHANNEL_0].trigger();
+    }
+    unsigned char sNote = amenSequence.getTrigger(1,sSequenceStep);
+    if(sNote)
+    {
+      synth.m_Voices[CHANNEL_1].triggerMidi(sNote);
+    }
+    sNote = amenSequence.getTrigger(2,sSequenceStep);
+    if(sNote)
+    {
+      synth.m_Voices[CHANNEL_2].triggerMidi(sNote);
+    }
+    if(amenSequence.getTrigger(3,sSequenceStep))
+    {
+      synth.m_Voices[CHANNEL_3].trigger();
+    }
+    sSequenceStep++;
+    if(sSequenceStep == amenSequence.getLength())
+    {
+      sSequenceStep = 0;
+    }
+  }
+
+  return unFrames;
+}
+
+struct SBenchCase
+{
+  const char *pName;
+  void (*pSetup)();
+  uint32_t (*pPass)();
+};
+
+static const SBenchCase sCases[] =
+{
+  {"voice-silent",setupVoiceSilent,passVoiceSilent},
+  {"voice-active",setupVoiceActive,passVoiceActive},
+  {"voice-envelope",setupVoiceEnvelope,passVoiceEnvelope},
+  {"voice-block",setupVoiceEnvelope,passVoiceBlock},
+  {"voice-interpolated",setupVoiceInterpolated,passVoiceBlock},
+  {"voice-adsr",setupVoiceADSR,passVoiceBlock},
+  {"mix-silent",setupMixSilent,passMix},
+  {"mix-active",setupMixSilent,passMixActive},
+  {"mix-sequence",setupMixSequence,passMixSequence},
+};
+
+#define CASE_COUNT (sizeof(sCases)/sizeof(sCases[0]))
+
+// Run the case for ulMilliseconds and return the nanoseconds per sample. The clock is only read every so many
+// passes so that reading it does not show up in the timings.
+static double runCase(const SBenchCase &benchCase,unsigned long ulMilliseconds)
+{
+  benchCase.pSetup();
+  sSequenceStep = 0;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::time_point end = start + std::chrono::milliseconds(ulMilliseconds);
+  std::chrono::steady_clock::time_point now;
+  uint64_t ullSamples = 0;
+  do
+  {
+    for(uint16_t unPass = 0;unPass < 256;unPass++)
+    {
+      ullSamples += benchCase.pPass();
+    }
+    now = std::chrono::steady_clock::now();
+  } while(now < end);
+
+  return std::chrono::duration<double,std::nano>(now - start).count() / (double)ullSamples;
+}
+
+static void usage()
+{
+  fprintf(stderr,
+    "usage: IllutronB_bench [-t milliseconds] [filter]\n"
+    "  -t  time to run each case for (default 200), each case is run %d times\n"
+    "  filter  only run the cases with this in their name\n",BENCH_RUNS);
+}
+
+int main(int argc,char **argv)
+{
+  unsigned long ulMilliseconds = 200;
+  const char *pFilter = NULL;
+
+  for(int nArg = 1;nArg < argc;nArg++)
+  {
+    if((0 == strcmp(argv[nArg],"-t")) && (nArg + 1 < argc))
+    {
+      ulMilliseconds = strtoul(argv[++nArg],NULL,10);
+    }
+    else if(('-' != argv[nArg][0]) && (NULL == pFilter))
+    {
+      pFilter = argv[nArg];
+    }
+    else
+    {
+      usage();
+      return 1;
+    }
+  }
+
+  if(0 == ulMilliseconds)
+  {
+    usage();
+    return 1;
+  }
+
+  printf("%-20s %12s %16s %14s\n","case","ns/sample","samples/second","x real time");
+  for(size_t unCase = 0;unCase < CASE_COUNT;unCase++)
+  {
+    const SBenchCase &benchCase = sCases[unCase];
+    if((NULL != pFilter) && (NULL == strstr(benchCase.pName,pFilter)))
+    {
+      continue;
+    }
+
+    double dBest = 0.0;
+    for(uint8_t sRun = 0;sRun < BENCH_RUNS;sRun++)
+    {
+      double dNanoseconds = runCase(benchCase,ulMilliseconds);
+      if((0 == sRun) || (dNanoseconds < dBest))
+      {
+        dBest = dNanoseconds;
+      }
+    }
+
+    double dSamplesPerSecond = 1e9 / dBest;
+    printf("%-20s %12.2f %16.0f %14.0f\n",benchCase.pName,dBest,dSamplesPerSecond,dSamplesPerSecond / UPDATE_RATE);
+  }
+
+  return 0;
+}
@@ -0,0 +1,439 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// IllutronB render farm
+//
+// Renders a whole list of patterns to WAV files using every core of the PC. Each job has its own CIllutronB so the
+// jobs are completely independent of each other, the sound of a job is exactly what IllutronB_render would give
+// for the same sequence, voices, tempo and length.
+//
+// Build from this folder with -
+//
+//   g++ -O2 -pthread -I../IllutronB_toby_rev2_v08_4 -o IllutronB_farm IllutronB_farm.cpp ../IllutronB_toby_rev2_v08_4/IllutronB.cpp
+//
+// and run with -
+//
+//   ./IllutronB_farm manifest.txt
+//   ./IllutronB_farm -j 8 -r 16000 manifest.txt
+//
+// The manifest has one job per line, blank lines and anything after a # are ignored -
+//
+//   # sequence  bpm  bars  voices  output
+//   amen        140  8     demo    amen-140.wav
+//   your2       90   16    sin/env0/200/0.4/300,ramp/env1/100/1.0/512,triangle/env2/100/0.5/1000,noise/env3/1200/0.04/500  your2-90.wav
+//   original    120  4     demo-kick,triangle,sin,noise-hat  original-presets.wav
+//
+//   sequence - original, amen, your or your2 - or 1 to 4 as the buttons on the board
+//   bpm      - 1 to 255
+//   bars     - the number of bars of 16 steps to render
+//   voices   - demo for the voices from setup() in the demo sketch, or four voices separated by commas
+//              each given as wave/envelope/pitch/length/mod - the same values as CVoice::setup takes - or as the
+//              name of one of the presets from Presets.h, see sPresetNames in IllutronB_host.h
+//   output   - the WAV file to write
+//
+// The jobs are shared out between the threads when we start, a thread which runs out of jobs of its own takes
+// (steals) jobs from the other threads so that they all keep busy until everything is done, even when some jobs
+// are much longer than others. When all of the jobs are done we print the time each one took and the total
+// number of samples per second rendered by all of the threads together.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "IllutronB_host.h"
+
+#define VOICE_SPEC_COUNT 4
+
+struct SVoiceSpec
+{
+  const SVoicePreset *pPreset;   // NULL unless the voice is a preset
+  uintptr_t unWave;
+  float fPitch;
+  uintptr_t unEnvelope;
+  float fLength;
+  unsigned int unMod;
+};
+
+struct SJob
+{
+  // from the manifest
+  unsigned int unLine;
+  CFlashSequence *pSequence;
+  uint8_t sBPM;
+  uint32_t ulBars;
+  bool bDemoVoices;
+  SVoiceSpec voices[VOICE_SPEC_COUNT];
+  std::string output;
+
+  // filled in by the thread which renders the job
+  bool bWritten;
+  size_t unSamples;
+  double dRenderMilliseconds;  // rendering the sound
+  double dTotalMilliseconds;   // rendering and writing the WAV file
+  double dFinishedAt;          // milliseconds from the start of the farm to the end of the job
+};
+
+// Look up a wave table or envelope by name, returns 0 if there is no such table
+static uintptr_t findTable(const STableName *pTables,size_t unTableCount,const char *pName)
+{
+  for(size_t unIndex = 0;unIndex < unTableCount;unIndex++)
+  {
+    if(0 == strcmp(pName,pTables[unIndex].pName))
+    {
+      return pTables[unIndex].unTable;
+    }
+  }
+  return 0;
+}
+
+// Look up a voice preset by name, returns NULL if there is no such preset
+static const SVoicePreset *findPreset(const char *pName)
+{
+  for(size_t unIndex = 0;unIndex < PRESET_NAME_COUNT;unIndex++)
+  {
+    if(0 == strcmp(pName,sPresetNames[unIndex].pName))
+    {
+      return &sPresets[sPresetNames[unIndex].sPreset];
+    }
+  }
+  return NULL;
+}
+
+// wave/envelope/pitch/length/mod or a preset name
+static bool parseVoice(char *pSpec,SVoiceSpec &voice)
+{
+  voice.pPreset = findPreset(pSpec);
+  if(NULL != voice.pPreset)
+  {
+    return true;
+  }
+
+  char *pFields[5];
+  for(uint8_t sField = 0;sField < 5;sField++)
+  {
+    pFields[sField] = pSpec;
+    if(NULL == pSpec)
+    {
+      return false;
+    }
+    pSpec = strchr(pSpec,'/');
+    if(NULL != pSpec)
+    {
+      *pSpec++ = 0;
+    }
+  }
+  if(NULL != pSpec)
+  {
+    return false;
+  }
+
+  voice.unWave = findTable(sWaveTables,WAVE_TABLE_COUNT,pFields[0]);
+  voice.unEnvelope = findTable(sEnvelopeTables,ENVELOPE_TABLE_COUNT,pFields[1]);
+  voice.fPitch = atof(pFields[2]);
+  voice.fLength = atof(pFields[3]);
+  voice.unMod = strtoul(pFields[4],NULL,10);
+  return (0 != voice.unWave) && (0 != voice.unEnvelope) && (voice.fPitch > 0.0) && (voice.fLength > 0.0);
+}
+
+static bool parseVoices(char *pVoices,SJob &job)
+{
+  job.bDemoVoices = (0 == strcmp(pVoices,"demo"));
+  if(job.bDemoVoices)
+  {
+    return true;
+  }
+
+  for(uint8_t sVoice = 0;sVoice < VOICE_SPEC_COUNT;sVoice++)
+  {
+    char *pNext = strchr(pVoices,',');
+    if((NULL == pNext) != (VOICE_SPEC_COUNT - 1 == sVoice))
+    {
+      return false;
+    }
+    if(NULL != pNext)
+    {
+      *pNext++ = 0;
+    }
+    if(!parseVoice(pVoices,job.voices[sVoice]))
+    {
+      return false;
+    }
+    pVoices = pNext;
+  }
+  return true;
+}
+
+static bool readManifest(const char *pFileName,std::vector<SJob> &jobs)
+{
+  FILE *pFile = fopen(pFileName,"r");
+  if(NULL == pFile)
+  {
+    fprintf(stderr,"IllutronB_farm: could not read %s\n",pFileName);
+    return false;
+  }
+
+  bool bOK = true;
+  char line[1024];
+  unsigned int unLine = 0;
+  while(NULL != fgets(line,sizeof(line),pFile))
+  {
+    unLine++;
+    char *pComment = strchr(line,'#');
+    if(NULL != pComment)
+    {
+      *pComment = 0;
+    }
+
+    char *pFields[5];
+    uint8_t sFields = 0;
+    for(char *pField = strtok(line," \t\r\n");NULL != pField;pField = strtok(NULL," \t\r\n"))
+    {
+      if(sFields < 5)
+      {
+        pFields[sFields] = pField;
+      }
+      sFields++;
+    }
+    if(0 == sFields)
+    {
+      continue;
+    }
+
+    SJob job;
+    job.unLine = unLine;
+    job.bWritten = false;
+    job.unSamples = 0;
+    job.dRenderMilliseconds = job.dTotalMilliseconds = job.dFinishedAt = 0.0;
+
+    unsigned long ulBPM = 0;
+    if(5 == sFields)
+    {
+      job.pSequence = findSequence(pFields[0]);
+      ulBPM = strtoul(pFields[1],NULL,10);
+      job.sBPM = ulBPM;
+      job.ulBars = strtoul(pFields[2],NULL,10);
+      job.output = pFields[4];
+    }
+    if((5 != sFields) || (NULL == job.pSequence) || (ulBPM < 1) || (ulBPM > 255) || (0 == job.ulBars) ||
+       !parseVoices(pFields[3],job))
+    {
+      fprintf(stderr,"IllutronB_farm: %s line %u is not a valid job\n",pFileName,unLine);
+      bOK = false;
+      continue;
+    }
+    jobs.push_back(job);
+  }
+
+  fclose(pFile);
+  return bOK;
+}
+
+static void renderJob(SJob &job,uint32_t unSampleRate,std::chrono::steady_clock::time_point farmStart)
+{
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  CIllutronB synth;
+  if(job.bDemoVoices)
+  {
+    setupVoices(synth);
+  }
+  else
+  {
+    for(uint8_t sVoice = 0;sVoice < VOICE_SPEC_COUNT;sVoice++)
+    {
+      const SVoiceSpec &voice = job.voices[sVoice];
+      if(NULL != voice.pPreset)
+      {
+        synth.m_Voices[sVoice].setPreset(voice.pPreset);
+      }
+      else
+      {
+        synth.m_Voices[sVoice].setup(voice.unWave,voice.fPitch,voice.unEnvelope,voice.fLength,voice.unMod);
+      }
+    }
+  }
+
+  // a copy of the sequence for each job, the cursor in a CFlashSequence can only follow one job at a time
+  CFlashSequence sequence = *job.pSequence;
+  std::vector<int8_t> samples;
+  renderSequence(synth,&sequence,job.sBPM,job.ulBars*STEPS_PER_BAR,samples);
+  std::chrono::steady_clock::time_point rendered = std::chrono::steady_clock::now();
+
+  job.bWritten = writeWav(job.output.c_str(),samples,unSampleRate);
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  job.unSamples = samples.size();
+  job.dRenderMilliseconds = std::chrono::duration<double,std::milli>(rendered - start).count();
+  job.dTotalMilliseconds = std::chrono::duration<double,std::milli>(end - start).count();
+  job.dFinishedAt = std::chrono::duration<double,std::milli>(end - farmStart).count();
+}
+
+// Each thread has its own queue of jobs, it works from the back of its own queue and steals from the front of the
+// others. There are no new jobs once we have started so a thread can stop as soon as it finds every queue empty.
+struct SWorkQueue
+{
+  std::mutex mutex;
+  std::deque<size_t> jobs;
+};
+
+static bool takeJob(std::vector<SWorkQueue> &queues,size_t unThread,size_t &unJob)
+{
+  for(size_t unOffset = 0;unOffset < queues.size();unOffset++)
+  {
+    SWorkQueue &queue = queues[(unThread + unOffset) % queues.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if(!queue.jobs.empty())
+    {
+      if(0 == unOffset)
+      {
+        unJob = queue.jobs.back();
+        queue.jobs.pop_back();
+      }
+      else
+      {
+        unJob = queue.jobs.front();
+        queue.jobs.pop_front();
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+static void usage()
+{
+  fprintf(stderr,
+    "usage: IllutronB_farm [-j threads] [-r 8000|16000] manifest\n"
+    "  -j  number of threads (default one per core)\n"
+    "  -r  sample rate of the WAV files (default 8000, the synth update rate)\n"
+    "  see the top of IllutronB_farm.cpp for the manifest format\n");
+}
+
+int main(int argc,char **argv)
+{
+  unsigned long ulThreads = std::thread::hardware_concurrency();
+  unsigned long ulSampleRate = UPDATE_RATE;
+  const char *pManifest = NULL;
+
+  for(int nArg = 1;nArg < argc;nArg++)
+  {
+    const char *pArg = argv[nArg];
+    const char *pValue = (nArg + 1 < argc) ? argv[nArg + 1] : NULL;
+
+    if((0 == strcmp(pArg,"-j")) && (NULL != pValue))
+    {
+      ulThreads = strtoul(pValue,NULL,10);
+      nArg++;
+    }
+    else if((0 == strcmp(pArg,"-r")) && (NULL != pValue))
+    {
+      ulSampleRate = strtoul(pValue,NULL,10);
+      nArg++;
+    }
+    else if(('-' != pArg[0]) && (NULL == pManifest))
+    {
+      pManifest = pArg;
+    }
+    else
+    {
+      usage();
+      return 1;
+    }
+  }
+
+  if(0 == ulThreads)
+  {
+    ulThreads = 1;
+  }
+
+  if((NULL == pManifest) || ((UPDATE_RATE != ulSampleRate) && ((2*UPDATE_RATE) != ulSampleRate)))
+  {
+    usage();
+    return 1;
+  }
+
+  std::vector<SJob> jobs;
+  if(!readManifest(pManifest,jobs))
+  {
+    return 1;
+  }
+  if(jobs.empty())
+  {
+    fprintf(stderr,"IllutronB_farm: %s has no jobs\n",pManifest);
+    return 1;
+  }
+  if(ulThreads > jobs.size())
+  {
+    ulThreads = jobs.size();
+  }
+
+  // deal the jobs out to the threads like cards
+  std::vector<SWorkQueue> queues(ulThreads);
+  for(size_t unJob = 0;unJob < jobs.size();unJob++)
+  {
+    queues[unJob % ulThreads].jobs.push_back(unJob);
+  }
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> threads;
+  for(size_t unThread = 0;unThread < ulThreads;unThread++)
+  {
+    threads.push_back(std::thread([&jobs,&queues,unThread,ulSampleRate,start]()
+    {
+      size_t unJob;
+      while(takeJob(queues,unThread,unJob))
+      {
+        renderJob(jobs[unJob],ulSampleRate,start);
+      }
+    }));
+  }
+  for(size_t unThread = 0;unThread < threads.size();unThread++)
+  {
+    threads[unThread].join();
+  }
+
+  double dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // the report, in the same order as the manifest
+  int nFailed = 0;
+  uint64_t ullSamples = 0;
+  double dMaxMilliseconds = 0.0;
+  double dTotalMilliseconds = 0.0;
+  printf("%-6s %-32s %10s %10s %10s %12s\n","line","output","samples","render ms","job ms","finished ms");
+  for(size_t unJob = 0;unJob < jobs.size();unJob++)
+  {
+    const SJob &job = jobs[unJob];
+    printf("%-6u %-32s %10lu %10.2f %10.2f %12.2f%s\n",job.unLine,job.output.c_str(),(unsigned long)job.unSamples,
+      job.dRenderMilliseconds,job.dTotalMilliseconds,job.dFinishedAt,job.bWritten ? "" : "  FAILED TO WRITE");
+    if(!job.bWritten)
+    {
+      nFailed++;
+    }
+    ullSamples += job.unSamples;
+    dTotalMilliseconds += job.dTotalMilliseconds;
+    if(job.dTotalMilliseconds > dMaxMilliseconds)
+    {
+      dMaxMilliseconds = job.dTotalMilliseconds;
+    }
+  }
+
+  double dSamplesPerSecond = (dSeconds > 0.0) ? ullSamples / dSeconds : 0.0;
+  printf("%lu jobs on %lu threads, %llu samples in %.2f ms - %.0f samples/second, %.0fx real time\n",
+    (unsigned long)jobs.size(),ulThreads,(unsigned long long)ullSamples,dSeconds * 1000.0,dSamplesPerSecond,dSamplesPerSecond / UPDATE_RATE);
+  printf("job time - average %.2f ms, longest %.2f ms\n",dTotalMilliseconds / jobs.size(),dMaxMilliseconds);
+
+  if(nFailed)
+  {
+    fprintf(stderr,"IllutronB_farm: %d jobs could not be written\n",nFailed);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,62 @@
+#ifndef _ILLUTRONB_GOLDEN_
+#define _ILLUTRONB_GOLDEN_
+
+// Hashes of the regression scenarios rendered by IllutronB_render -c
+// Only ever change these when the sound has been changed on purpose - regenerate them with IllutronB_render -g
+
+struct SGolden
+{
+  const char *pName;
+  uint64_t ullHash;
+};
+
+static const SGolden sGoldens[] =
+{
+  {"sin-env0",0x83a7e67482a0610bULL},
+  {"sin-env1",0x1d1e65e2d44618c1ULL},
+  {"sin-env2",0x50371f7f3f843183ULL},
+  {"sin-env3",0xaad7c7c35a760bdcULL},
+  {"ramp-env0",0xe0e0f3eccef8c78eULL},
+  {"ramp-env1",0xe3f2545ad76b022dULL},
+  {"ramp-env2",0xb93eeff4d7bfd7a8ULL},
+  {"ramp-env3",0xe0bcda27d3338f25ULL},
+  {"saw-env0",0x87881a8ac8b97a61ULL},
+  {"saw-env1",0xec25a03c3b8ff73aULL},
+  {"saw-env2",0xbedd1347a1f7f5dbULL},
+  {"saw-env3",0xf9d34d838d523ef2ULL},
+  {"square-env0",0xe8b2a0f119dcc575ULL},
+  {"square-env1",0x04827d4186264a44ULL},
+  {"square-env2",0xaf904ab9f1d83ffcULL},
+  {"square-env3",0x09c47479c03b054dULL},
+  {"noise-env0",0x74f4000710547ccdULL},
+  {"noise-env1",0x8be9a2e45118eea3ULL},
+  {"noise-env2",0x68696f54454d371dULL},
+  {"noise-env3",0x94db43f2295e2b44ULL},
+  {"triangle-env0",0xe39fc6c1bce4edcdULL},
+  {"triangle-env1",0xe789a17a5d045646ULL},
+  {"triangle-env2",0xda876a674d28dadeULL},
+  {"triangle-env3",0x6832e3aafc9b8fdbULL},
+  {"sin-interpolated",0x9acff63e03705badULL},
+  {"ramp-interpolated",0x48fa2a8bb6a753c4ULL},
+  {"saw-interpolated",0x41a9b7436281419dULL},
+  {"square-interpolated",0x4b1c186dd773df0aULL},
+  {"noise-interpolated",0x6299e391111120c6ULL},
+  {"triangle-interpolated",0xcac8327331105abbULL},
+  {"saw-mipmap",0x9aecad1215ca310bULL},
+  {"ramp-mipmap",0x59ea5db8f391e27cULL},
+  {"square-mipmap",0x9d8e5f5533f192cfULL},
+  {"sin-adsr",0x41eaec6aa97ace2eULL},
+  {"original",0x7e810fbdc65ae83cULL},
+  {"amen",0x1df064d77098bf90ULL},
+  {"your",0x1287a16a7d488e96ULL},
+  {"your2",0x906708bd1593e64eULL},
+  {"original-split",0x88d2ff28faa43915ULL},
+  {"original-pan",0x6c7320261ac42f6aULL},
+  {"original-pan-127",0x5c2c480791e6be73ULL},
+  {"original-pan-129",0xcb7162ec6b605da7ULL},
+  {"original-song",0x60dc749378d8416eULL},
+};
+
+#define GOLDEN_COUNT (sizeof(sGoldens)/sizeof(sGoldens[0]))
+
+#endif
@@ -0,0 +1,282 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// IllutronB host tools - shared parts
+//
+// The wave tables, envelopes and sequences from the sketch, with names so that they can be chosen from the command
+// line, and the code to play a sequence the way the demo sketch does and write the result to a WAV file.
+// Each host tool is a single .cpp file which includes this, so the functions here are all static.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ILLUTRONB_HOST
+#define ILLUTRONB_HOST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "IllutronB.h"
+
+#include "sin256.h"
+#include "ramp256.h"
+#include "saw256.h"
+#include "square256.h"
+#include "noise256.h"
+#include "tria256.h"
+
+#include "saw256mip.h"
+#include "ramp256mip.h"
+#include "square256mip.h"
+
+#include "env0.h"
+#include "env1.h"
+#include "env2.h"
+#include "env3.h"
+
+#include "AmenBreak.h"
+#include "Presets.h"
+#include "Song.h"
+
+// The sequences are written for the four voices of the Arduino, a host build can have more but not fewer
+#if CHANNEL_MAX < 4
+#error the sequences need at least four voices
+#endif
+
+// The sequences step four times per beat, so there are 16 steps in a bar of 4/4
+#define STEPS_PER_BAR 16
+
+struct SSequenceName
+{
+  const char *pName;
+  CFlashSequence *pSequence;
+};
+
+// The same order as the buttons on the board
+static const SSequenceName sSequences[] =
+{
+  {"original",&originalSequence},
+  {"amen",&amenSequence},
+  {"your",&yourSequence},
+  {"your2",&yourSequence2},
+};
+
+#define SEQUENCE_COUNT (sizeof(sSequences)/sizeof(sSequences[0]))
+
+// the voices from setup() in the demo sketch
+static void setupVoices(CIllutronB &synth)
+{
+  synth.m_Voices[0].setPreset(&sPresets[PRESET_DEMO_KICK]);
+  synth.m_Voices[1].setPreset(&sPresets[PRESET_DEMO_BASS]);
+  synth.m_Voices[2].setPreset(&sPresets[PRESET_DEMO_SNARE]);
+  synth.m_Voices[3].setPreset(&sPresets[PRESET_DEMO_HAT]);
+}
+
+// Play the notes for one step of the sequence in the same way as loop() in the demo sketch -
+// channels 0 and 3 are drums which repeat the same sound, channels 1 and 2 play the midi note in the sequence.
+static void triggerStep(CIllutronB &synth,CFlashSequence *pSequence,unsigned char sStep)
+{
+  STriggers triggers = pSequence->getTriggers(sStep);
+  if(triggers.sNotes[0])
+  {
+    synth.m_Voices[CHANNEL_0].trigger();
+  }
+
+  if(triggers.sNotes[1])
+  {
+    synth.m_Voices[CHANNEL_1].triggerMidi(triggers.sNotes[1]);
+  }
+
+  if(triggers.sNotes[2])
+  {
+    synth.m_Voices[CHANNEL_2].triggerMidi(triggers.sNotes[2]);
+  }
+
+  if(triggers.sNotes[3])
+  {
+    synth.m_Voices[CHANNEL_3].trigger();
+  }
+}
+
+// Render unSteps steps of the sequence, the sketch plays each step when the previous beat completes so we render
+// exactly up to the end of the beat and then trigger the next step - the notes land on the same sample as they
+// would if loop() had no other work to do.
+// pOutputB collects output B as well, see CIllutronB::setOutputMode - leave it out for just output A
+// With pSong the song is told each time the sequence gets to the end, as the sketch does in song mode - pSequence is then
+// the sequence chosen with the buttons.
+static void renderSequence(CIllutronB &synth,CFlashSequence *pSequence,uint8_t sBPM,uint32_t unSteps,std::vector<int8_t> &output,
+  std::vector<int8_t> *pOutputB = NULL,CSong *pSong = NULL)
+{
+  synth.setBPM(sBPM);
+  CFlashSequence *pButtonSequence = pSequence;
+  if(NULL != pSong)
+  {
+    pSong->start(synth);
+  }
+
+  unsigned char sStep = 0;
+  for(uint32_t unStep = 0;unStep < unSteps;unStep++)
+  {
+    size_t unFrames = synth.getSamplesToBeat();
+    size_t unStart = output.size();
+    output.resize(unStart + unFrames);
+    if(NULL != pOutputB)
+    {
+      pOutputB->resize(unStart + unFrames);
+      synth.render(&output[unStart],&(*pOutputB)[unStart],unFrames);
+    }
+    else
+    {
+      synth.render(&output[unStart],unFrames);
+    }
+
+    synth.beatComplete();
+    triggerStep(synth,pSequence,sStep);
+
+    sStep++;
+    if(sStep == pSequence->getLength())
+    {
+      sStep = 0;
+      if((NULL != pSong) && pSong->endOfSequence(synth))
+      {
+        pSequence = pSong->getSequence(pButtonSequence);
+      }
+    }
+  }
+}
+
+struct STableName
+{
+  const char *pName;
+  uintptr_t unTable;
+};
+
+static const STableName sWaveTables[] =
+{
+  {"sin",(uintptr_t)SinTable},
+  {"ramp",(uintptr_t)RampTable},
+  {"saw",(uintptr_t)SawTable},
+  {"square",(uintptr_t)SquareTable},
+  {"noise",(uintptr_t)NoiseTable},
+  {"triangle",(uintptr_t)TriangleTable},
+};
+
+static const STableName sEnvelopeTables[] =
+{
+  {"env0",(uintptr_t)Env0},
+  {"env1",(uintptr_t)Env1},
+  {"env2",(uintptr_t)Env2},
+  {"env3",(uintptr_t)Env3},
+};
+
+// the band limited tables for CVoice::setMipmap, see IllutronB_mipmap
+static const STableName sMipmapTables[] =
+{
+  {"saw",(uintptr_t)SawMipmap},
+  {"ramp",(uintptr_t)RampMipmap},
+  {"square",(uintptr_t)SquareMipmap},
+};
+
+struct SPresetName
+{
+  const char *pName;
+  uint8_t sPreset;
+};
+
+// the voice presets from Presets.h
+static const SPresetName sPresetNames[] =
+{
+  {"demo-kick",PRESET_DEMO_KICK},
+  {"demo-bass",PRESET_DEMO_BASS},
+  {"demo-snare",PRESET_DEMO_SNARE},
+  {"demo-hat",PRESET_DEMO_HAT},
+  {"triangle-hat",PRESET_TRIANGLE_HAT},
+  {"noise-hat",PRESET_NOISE_HAT},
+  {"triangle-long",PRESET_TRIANGLE_LONG},
+  {"triangle",PRESET_TRIANGLE},
+  {"triangle-short",PRESET_TRIANGLE_SHORT},
+  {"ramp",PRESET_RAMP},
+  {"noise-short",PRESET_NOISE_SHORT},
+  {"sin-long",PRESET_SIN_LONG},
+  {"noise",PRESET_NOISE},
+  {"ramp-long",PRESET_RAMP_LONG},
+  {"sin",PRESET_SIN},
+};
+
+#define WAVE_TABLE_COUNT (sizeof(sWaveTables)/sizeof(sWaveTables[0]))
+#define PRESET_NAME_COUNT (sizeof(sPresetNames)/sizeof(sPresetNames[0]))
+#define MIPMAP_TABLE_COUNT (sizeof(sMipmapTables)/sizeof(sMipmapTables[0]))
+#define ENVELOPE_TABLE_COUNT (sizeof(sEnvelopeTables)/sizeof(sEnvelopeTables[0]))
+
+// Look up a sequence by name, or by the number of its button on the board - 1 to 4. Returns NULL if there is no such sequence.
+static CFlashSequence *findSequence(const char *pName)
+{
+  for(size_t unIndex = 0;unIndex < SEQUENCE_COUNT;unIndex++)
+  {
+    if((0 == strcmp(pName,sSequences[unIndex].pName)) || ((unsigned long)atoi(pName) == unIndex + 1))
+    {
+      return sSequences[unIndex].pSequence;
+    }
+  }
+  return NULL;
+}
+
+static void put16(FILE *pFile,uint16_t unValue)
+{
+  fputc(unValue & 0xFF,pFile);
+  fputc(unValue >> 8,pFile);
+}
+
+static void put32(FILE *pFile,uint32_t unValue)
+{
+  put16(pFile,unValue & 0xFFFF);
+  put16(pFile,unValue >> 16);
+}
+
+// Write 8 bit PCM, 8 bit WAV samples are unsigned so we offset them by 127 exactly as the AVR backend does
+// for the PWM output. At 16000Hz each sample is written twice - the PWM output also holds each sample until the next one.
+// With pSamplesB the file is stereo, output A (pin 6) on the left and output B (pin 5) on the right.
+static bool writeWav(const char *pFileName,const std::vector<int8_t> &samples,uint32_t unSampleRate,
+  const std::vector<int8_t> *pSamplesB = NULL)
+{
+  FILE *pFile = fopen(pFileName,"wb");
+  if(NULL == pFile)
+  {
+    return false;
+  }
+
+  uint32_t unRepeat = unSampleRate / UPDATE_RATE;
+  uint16_t unChannels = (NULL != pSamplesB) ? 2 : 1;
+  uint32_t unDataSize = samples.size() * unRepeat * unChannels;
+
+  fwrite("RIFF",1,4,pFile);
+  put32(pFile,36 + unDataSize);
+  fwrite("WAVEfmt ",1,8,pFile);
+  put32(pFile,16);            // size of the fmt chunk
+  put16(pFile,1);             // PCM
+  put16(pFile,unChannels);
+  put32(pFile,unSampleRate);
+  put32(pFile,unSampleRate * unChannels);  // bytes per second
+  put16(pFile,unChannels);                 // bytes per frame
+  put16(pFile,8);             // bits per sample
+  fwrite("data",1,4,pFile);
+  put32(pFile,unDataSize);
+
+  for(size_t unIndex = 0;unIndex < samples.size();unIndex++)
+  {
+    uint8_t sOutput = 127 + samples[unIndex];
+    uint8_t sOutputB = (NULL != pSamplesB) ? 127 + (*pSamplesB)[unIndex] : 0;
+    for(uint32_t unCopy = 0;unCopy < unRepeat;unCopy++)
+    {
+      fputc(sOutput,pFile);
+      if(NULL != pSamplesB)
+      {
+        fputc(sOutputB,pFile);
+      }
+    }
+  }
+
+  return 0 == fclose(pFile);
+}
+
+#endif
@@ -0,0 +1,167 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// IllutronB mipmap generator
+//
+// Makes the band limited versions of the saw, ramp and square wave tables used by CVoice::setMipmap and writes them
+// as headers into the sketch folder, ready to #include in the sketch like any other wave table.
+//
+// A 256 entry table can hold up to 128 harmonics. Each table is split into its harmonics with a discrete Fourier
+// transform and then put back together MIPMAP_LEVELS times, level n with only the first 128>>n harmonics. Level 0 has
+// all of them and so the shape of the original table. Cutting harmonics off makes the edges ring a little, so every
+// level is scaled by the same amount to keep the loudest of them in 8 bits, the levels then all sound equally loud.
+// That includes level 0 - it comes out at about 0.87 of the original saw and ramp and 0.78 of the square, so it is
+// quieter than SawTable, RampTable and SquareTable and does not match them sample for sample.
+//
+// Build from this folder with -
+//
+//   g++ -O2 -I../IllutronB_toby_rev2_v08_4 -o IllutronB_mipmap IllutronB_mipmap.cpp
+//
+// and run with -
+//
+//   ./IllutronB_mipmap             - write saw256mip.h, ramp256mip.h and square256mip.h into ../IllutronB_toby_rev2_v08_4
+//   ./IllutronB_mipmap folder      - write them somewhere else
+//
+// The output only depends on the tables, so running it again gives exactly the same headers.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+
+#include "IllutronB.h"
+
+#include "ramp256.h"
+#include "saw256.h"
+#include "square256.h"
+
+#define TABLE_SIZE 256
+#define HARMONIC_MAX (TABLE_SIZE/2)
+
+struct SMipmapTable
+{
+  const char *pFileName;    // the header we write
+  const char *pGuard;       // its include guard
+  const char *pSource;      // the name of the original table
+  const char *pName;        // the name of the mipmapped table
+  const signed char *pTable;
+};
+
+static const SMipmapTable sMipmapTables[] =
+{
+  {"saw256mip.h","_SAW_MIPMAP_","SawTable","SawMipmap",SawTable},
+  {"ramp256mip.h","_RAMP_MIPMAP_","RampTable","RampMipmap",RampTable},
+  {"square256mip.h","_SQUARE_MIPMAP_","SquareTable","SquareMipmap",SquareTable},
+};
+
+#define MIPMAP_TABLE_COUNT (sizeof(sMipmapTables)/sizeof(sMipmapTables[0]))
+
+// Build every level of one table into sLevels
+static void buildLevels(const signed char *pTable,signed char sLevels[MIPMAP_LEVELS][TABLE_SIZE])
+{
+  // the cosine and sine parts of each harmonic, harmonic 0 is the DC offset
+  double dCos[HARMONIC_MAX+1];
+  double dSin[HARMONIC_MAX+1];
+  for(int nHarmonic = 0;nHarmonic <= HARMONIC_MAX;nHarmonic++)
+  {
+    dCos[nHarmonic] = 0.0;
+    dSin[nHarmonic] = 0.0;
+    for(int nIndex = 0;nIndex < TABLE_SIZE;nIndex++)
+    {
+      double dAngle = (2.0 * M_PI * nHarmonic * nIndex) / TABLE_SIZE;
+      dCos[nHarmonic] += pTable[nIndex] * cos(dAngle);
+      dSin[nHarmonic] += pTable[nIndex] * sin(dAngle);
+    }
+  }
+
+  // put each level back together from its harmonics - DC and the top harmonic appear once in the transform,
+  // the others appear twice (as positive and negative frequencies) so they count double
+  double dLevels[MIPMAP_LEVELS][TABLE_SIZE];
+  double dPeak = 0.0;
+  for(int nLevel = 0;nLevel < MIPMAP_LEVELS;nLevel++)
+  {
+    int nHarmonics = HARMONIC_MAX >> nLevel;
+    for(int nIndex = 0;nIndex < TABLE_SIZE;nIndex++)
+    {
+      double dValue = dCos[0];
+      for(int nHarmonic = 1;nHarmonic <= nHarmonics;nHarmonic++)
+      {
+        double dAngle = (2.0 * M_PI * nHarmonic * nIndex) / TABLE_SIZE;
+        double dWeight = (HARMONIC_MAX == nHarmonic) ? 1.0 : 2.0;
+        dValue += dWeight * ((dCos[nHarmonic] * cos(dAngle)) + (dSin[nHarmonic] * sin(dAngle)));
+      }
+      dValue /= TABLE_SIZE;
+      dLevels[nLevel][nIndex] = dValue;
+      if(fabs(dValue) > dPeak)
+      {
+        dPeak = fabs(dValue);
+      }
+    }
+  }
+
+  // one scale for all of the levels, never louder than the original
+  double dScale = (dPeak > 127.0) ? (127.0 / dPeak) : 1.0;
+  for(int nLevel = 0;nLevel < MIPMAP_LEVELS;nLevel++)
+  {
+    for(int nIndex = 0;nIndex < TABLE_SIZE;nIndex++)
+    {
+      long lValue = lround(dLevels[nLevel][nIndex] * dScale);
+      sLevels[nLevel][nIndex] = (lValue > 127) ? 127 : ((lValue < -128) ? -128 : lValue);
+    }
+  }
+}
+
+static bool writeHeader(const std::string &path,const SMipmapTable &mipmap,signed char sLevels[MIPMAP_LEVELS][TABLE_SIZE])
+{
+  FILE *pFile = fopen(path.c_str(),"w");
+  if(NULL == pFile)
+  {
+    return false;
+  }
+
+  fprintf(pFile,"#ifndef %s\n#define %s\n\n",mipmap.pGuard,mipmap.pGuard);
+  fprintf(pFile,"// Band limited versions of %s for CVoice::setMipmap - made by IllutronB_host/IllutronB_mipmap, do not edit.\n",mipmap.pSource);
+  fprintf(pFile,"// %d tables of %d entries one after the other, level n has the first %d>>n harmonics of %s and\n",MIPMAP_LEVELS,TABLE_SIZE,HARMONIC_MAX,mipmap.pSource);
+  fprintf(pFile,"// is played for notes with a wave phase increment up to 256<<n, any higher and its top harmonic would alias.\n\n");
+  fprintf(pFile,"PROGMEM const signed char %s[]=\n{\n",mipmap.pName);
+  for(int nLevel = 0;nLevel < MIPMAP_LEVELS;nLevel++)
+  {
+    fprintf(pFile,"\t// level %d - %d harmonics\n",nLevel,HARMONIC_MAX >> nLevel);
+    for(int nIndex = 0;nIndex < TABLE_SIZE;nIndex++)
+    {
+      fprintf(pFile,"\t%d,\t//%d\n",sLevels[nLevel][nIndex],(nLevel*TABLE_SIZE) + nIndex);
+    }
+  }
+  fprintf(pFile,"};\n\n#endif\n");
+
+  return 0 == fclose(pFile);
+}
+
+int main(int argc,char **argv)
+{
+  if(argc > 2)
+  {
+    fprintf(stderr,"usage: IllutronB_mipmap [folder]\n");
+    return 1;
+  }
+  std::string folder = (argc == 2) ? argv[1] : "../IllutronB_toby_rev2_v08_4";
+
+  for(size_t unTable = 0;unTable < MIPMAP_TABLE_COUNT;unTable++)
+  {
+    const SMipmapTable &mipmap = sMipmapTables[unTable];
+    signed char sLevels[MIPMAP_LEVELS][TABLE_SIZE];
+    buildLevels(mipmap.pTable,sLevels);
+
+    std::string path = folder + "/" + mipmap.pFileName;
+    if(!writeHeader(path,mipmap,sLevels))
+    {
+      fprintf(stderr,"IllutronB_mipmap: could not write %s\n",path.c_str());
+      return 1;
+    }
+    printf("wrote %s\n",path.c_str());
+  }
+
+  return 0;
+}
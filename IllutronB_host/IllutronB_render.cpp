@@ -0,0 +1,429 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// IllutronB offline renderer
+//
+// Plays one of the sequences from AmenBreak.h through the IllutronB render core and writes the result to a WAV file.
+// Its the same integer maths as the Arduino uses, so what you hear is what the synth will play, but it runs on a PC
+// hundreds of times faster than real time - handy for trying out a new pattern without flashing a board every time.
+//
+// Build from this folder with -
+//
+//   g++ -O2 -I../IllutronB_toby_rev2_v08_4 -o IllutronB_render IllutronB_render.cpp ../IllutronB_toby_rev2_v08_4/IllutronB.cpp
+//
+// add -DCHANNEL_MAX=16 to try a build with more voices, the sequences only play the first four.
+//
+// and run with -
+//
+//   ./IllutronB_render -s amen -b 8 -t 140 amen.wav
+//
+// add -i to hear the voices with wave table interpolation turned on, see CVoice::setInterpolation.
+// add -m split or -m pan for a stereo WAV file of both PWM outputs, pin 6 on the left and pin 5 on the right -
+// see CIllutronB::setOutputMode. With pan the voices are spread evenly from left to right.
+//
+// The voices are configured as they are at the start of the demo sketch, the voice changes the sketch makes
+// as the sequence cycles round are not played - add -a to play the sequence as the demo song (see Song.h) with them.
+//
+// Regression check -
+//
+//   ./IllutronB_render -c
+//
+// renders a fixed set of scenarios - every wave table with every envelope, every wave table interpolated, the
+// mipmapped tables, an ADSR envelope, each of the four sequences, the original sequence split and panned across
+// both outputs and then played as the demo song - and compares a hash of every sample against
+// the hashes in IllutronB_golden.h. Any change to the render core which is meant to make it faster must pass this
+// check, it proves the sound is exactly the same. It returns 0 if all the scenarios match and 1 if any of them do not.
+//
+// On a PC with SSE2 or NEON the voices are mixed with vector instructions, build with -DILLUTRONB_NO_SIMD as well and
+// check both - the vector mix must give exactly the same samples as the plain C++ mix used on the Arduino.
+//
+// -c also checks that CVoice::getFrequencyFromMidiNoteNumber, which is a table look up so the Arduino does not need any
+// float maths, gives exactly what the old pow(2,(note-69)/12)*440 gave for all 128 notes.
+//
+// The Arduino should never do float maths while it plays - see ILLUTRONB_NO_FLOAT in IllutronB.h. Check that the core
+// still builds without any with -
+//
+//   g++ -c -O2 -DILLUTRONB_NO_FLOAT -DILLUTRONB_NO_SIMD -mgeneral-regs-only -o /dev/null ../IllutronB_toby_rev2_v08_4/IllutronB.cpp
+//
+// -mgeneral-regs-only stops the compiler using the float registers, so any float or double left in the core is an error.
+//
+// If you have changed the sound on purpose, check the new sound by ear and then use -g to print new hashes
+// to paste into IllutronB_golden.h
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "IllutronB_host.h"
+
+#include "IllutronB_golden.h"
+
+// the original sequence split, panned across the outputs and with every voice just either side of the middle
+#define SCENARIO_OUTPUT_COUNT 4
+#define SCENARIO_COUNT ((WAVE_TABLE_COUNT*ENVELOPE_TABLE_COUNT) + WAVE_TABLE_COUNT + MIPMAP_TABLE_COUNT + 1 + SEQUENCE_COUNT + SCENARIO_OUTPUT_COUNT + 1)
+
+// The regression scenarios render at a fixed tempo and length so that the hashes never change unless the sound does
+#define SCENARIO_BPM 120
+#define SCENARIO_BARS 8
+#define SCENARIO_NOTE_SAMPLES 4500  // a little longer than the envelope of a note with length 0.5
+#define SCENARIO_SONG_BARS 32       // the demo song is sixteen times through the original sequence
+
+// walk a single voice up through the midi notes so we cover the whole range of wave phase increments
+// bRelease lets go of each note half way through, for the ADSR envelope
+static void renderNotes(CIllutronB &synth,std::vector<int8_t> &output,bool bRelease = false)
+{
+  for(unsigned char sNote = 24;sNote <= 96;sNote += 6)
+  {
+    synth.m_Voices[0].triggerMidi(sNote);
+    size_t unStart = output.size();
+    output.resize(unStart + SCENARIO_NOTE_SAMPLES);
+    if(bRelease)
+    {
+      synth.render(&output[unStart],SCENARIO_NOTE_SAMPLES/2);
+      synth.m_Voices[0].release();
+      synth.render(&output[unStart + (SCENARIO_NOTE_SAMPLES/2)],SCENARIO_NOTE_SAMPLES - (SCENARIO_NOTE_SAMPLES/2));
+    }
+    else
+    {
+      synth.render(&output[unStart],SCENARIO_NOTE_SAMPLES);
+    }
+  }
+}
+
+// spread the voices evenly from output A to output B for OUTPUT_PAN, voice 0 all the way to A and the last voice all the way to B
+static void panVoices(CIllutronB &synth)
+{
+  for(uint8_t sVoice = 0;sVoice < CHANNEL_MAX;sVoice++)
+  {
+    synth.m_Voices[sVoice].setPan((CHANNEL_MAX > 1) ? (sVoice * 255) / (CHANNEL_MAX - 1) : 128);
+  }
+}
+
+// The first scenarios play a single voice with each combination of wave table and envelope, then each wave table again
+// with interpolation turned on, each of the mipmapped tables and a sine with an ADSR envelope. The last few play each
+// of the sequences, the next four play the original sequence in OUTPUT_SPLIT and OUTPUT_PAN - spread across the outputs
+// and then with every voice at 127 and at 129, either side of the middle - with the two outputs interleaved as they would
+// be in a stereo WAV file and the last plays the whole of the demo song.
+static void renderScenario(size_t unScenario,char *pName,size_t unNameSize,std::vector<int8_t> &output)
+{
+  // a new synth for every scenario so that each one starts from the same place
+  CIllutronB synth;
+
+  if(unScenario < (WAVE_TABLE_COUNT*ENVELOPE_TABLE_COUNT))
+  {
+    const STableName &wave = sWaveTables[unScenario / ENVELOPE_TABLE_COUNT];
+    const STableName &envelope = sEnvelopeTables[unScenario % ENVELOPE_TABLE_COUNT];
+    snprintf(pName,unNameSize,"%s-%s",wave.pName,envelope.pName);
+
+    synth.m_Voices[0].setup(wave.unTable,200.0,envelope.unTable,0.5,512);
+    renderNotes(synth,output);
+  }
+  else if(unScenario < (WAVE_TABLE_COUNT*ENVELOPE_TABLE_COUNT) + WAVE_TABLE_COUNT)
+  {
+    const STableName &wave = sWaveTables[unScenario - (WAVE_TABLE_COUNT*ENVELOPE_TABLE_COUNT)];
+    snprintf(pName,unNameSize,"%s-interpolated",wave.pName);
+
+    synth.m_Voices[0].setup(wave.unTable,200.0,(uintptr_t)Env1,0.5,512);
+    synth.m_Voices[0].setInterpolation(true);
+    renderNotes(synth,output);
+  }
+  else if(unScenario < (WAVE_TABLE_COUNT*ENVELOPE_TABLE_COUNT) + WAVE_TABLE_COUNT + MIPMAP_TABLE_COUNT)
+  {
+    const STableName &wave = sMipmapTables[unScenario - (WAVE_TABLE_COUNT*ENVELOPE_TABLE_COUNT) - WAVE_TABLE_COUNT];
+    snprintf(pName,unNameSize,"%s-mipmap",wave.pName);
+
+    synth.m_Voices[0].setup(wave.unTable,200.0,(uintptr_t)Env1,0.5,512);
+    synth.m_Voices[0].setMipmap(true);
+    renderNotes(synth,output);
+  }
+  else if(unScenario == (WAVE_TABLE_COUNT*ENVELOPE_TABLE_COUNT) + WAVE_TABLE_COUNT + MIPMAP_TABLE_COUNT)
+  {
+    snprintf(pName,unNameSize,"sin-adsr");
+
+    // every stage - a quick attack, a decay to half volume, sustain until the release half way through the note
+    synth.m_Voices[0].setup((uintptr_t)SinTable,200.0,0,0.5,512);
+    synth.m_Voices[0].setADSR(0.02,0.1,128,0.2);
+    renderNotes(synth,output,true);
+  }
+  else if(unScenario < SCENARIO_COUNT - SCENARIO_OUTPUT_COUNT - 1)
+  {
+    const SSequenceName &sequence = sSequences[unScenario - (WAVE_TABLE_COUNT*ENVELOPE_TABLE_COUNT) - WAVE_TABLE_COUNT - MIPMAP_TABLE_COUNT - 1];
+    snprintf(pName,unNameSize,"%s",sequence.pName);
+
+    setupVoices(synth);
+    renderSequence(synth,sequence.pSequence,SCENARIO_BPM,SCENARIO_BARS*STEPS_PER_BAR,output);
+  }
+  else if(unScenario < SCENARIO_COUNT - 1)
+  {
+    size_t unOutput = unScenario - (SCENARIO_COUNT - SCENARIO_OUTPUT_COUNT - 1);
+    static const char *pOutputNames[SCENARIO_OUTPUT_COUNT] = {"original-split","original-pan","original-pan-127","original-pan-129"};
+    snprintf(pName,unNameSize,"%s",pOutputNames[unOutput]);
+    bool bPan = (0 != unOutput);
+
+    setupVoices(synth);
+    if(1 == unOutput)
+    {
+      panVoices(synth);
+    }
+    else if(bPan)
+    {
+      for(uint8_t sVoice = 0;sVoice < CHANNEL_MAX;sVoice++)
+      {
+        synth.m_Voices[sVoice].setPan((2 == unOutput) ? 127 : 129);
+      }
+    }
+    synth.setOutputMode(bPan ? CIllutronB::OUTPUT_PAN : CIllutronB::OUTPUT_SPLIT);
+    std::vector<int8_t> outputA;
+    std::vector<int8_t> outputB;
+    renderSequence(synth,&originalSequence,SCENARIO_BPM,SCENARIO_BARS*STEPS_PER_BAR,outputA,&outputB);
+    for(size_t unIndex = 0;unIndex < outputA.size();unIndex++)
+    {
+      output.push_back(outputA[unIndex]);
+      output.push_back(outputB[unIndex]);
+    }
+  }
+  else
+  {
+    snprintf(pName,unNameSize,"original-song");
+
+    setupVoices(synth);
+    renderSequence(synth,&originalSequence,SCENARIO_BPM,SCENARIO_SONG_BARS*STEPS_PER_BAR,output,NULL,&song);
+  }
+}
+
+// 64 bit FNV-1a over the raw samples
+static uint64_t hashSamples(const std::vector<int8_t> &samples)
+{
+  uint64_t ullHash = 14695981039346656037ULL;
+  for(size_t unIndex = 0;unIndex < samples.size();unIndex++)
+  {
+    ullHash ^= (uint8_t)samples[unIndex];
+    ullHash *= 1099511628211ULL;
+  }
+  return ullHash;
+}
+
+// The midi note frequencies used to be worked out with pow, the table in IllutronB.cpp must give the same for every note
+static int checkMidiFrequencies()
+{
+  CIllutronB synth;
+  int nFailed = 0;
+  for(int nNote = 0;nNote < 128;nNote++)
+  {
+    unsigned int unExpected = pow(2,((float)nNote-69.0)/12.0)*440;
+    unsigned int unFrequency = synth.m_Voices[0].getFrequencyFromMidiNoteNumber(nNote);
+    if(unFrequency != unExpected)
+    {
+      printf("FAIL midi note %d - %u hz rather than %u\n",nNote,unFrequency,unExpected);
+      nFailed++;
+    }
+  }
+  if(0 == nFailed)
+  {
+    printf("pass midi note frequencies\n");
+  }
+  return nFailed;
+}
+
+// Render every scenario, either checking it against IllutronB_golden.h or printing its hash in the same format
+static int checkScenarios(bool bGenerate)
+{
+#if CHANNEL_MAX != 4
+  // more voices means a bigger mixer shift and a quieter sound, the hashes cannot match
+  if(!bGenerate)
+  {
+    printf("the hashes in IllutronB_golden.h are for four voices, build without -DCHANNEL_MAX to check them\n");
+    return 1;
+  }
+#endif
+
+  int nFailed = 0;
+  for(size_t unScenario = 0;unScenario < SCENARIO_COUNT;unScenario++)
+  {
+    char name[32];
+    std::vector<int8_t> samples;
+    renderScenario(unScenario,name,sizeof(name),samples);
+    uint64_t ullHash = hashSamples(samples);
+
+    if(bGenerate)
+    {
+      printf("  {\"%s\",0x%016llxULL},\n",name,(unsigned long long)ullHash);
+      continue;
+    }
+
+    const SGolden *pGolden = NULL;
+    for(size_t unGolden = 0;unGolden < GOLDEN_COUNT;unGolden++)
+    {
+      if(0 == strcmp(name,sGoldens[unGolden].pName))
+      {
+        pGolden = &sGoldens[unGolden];
+      }
+    }
+
+    if((NULL != pGolden) && (pGolden->ullHash == ullHash))
+    {
+      printf("pass %s\n",name);
+    }
+    else
+    {
+      printf("FAIL %s - hash 0x%016llx\n",name,(unsigned long long)ullHash);
+      nFailed++;
+    }
+  }
+
+  if(!bGenerate)
+  {
+    int nMidiFailed = checkMidiFrequencies();
+    printf("%d of %d scenarios failed\n",nFailed,(int)SCENARIO_COUNT);
+    nFailed += nMidiFailed;
+  }
+  return (0 == nFailed) ? 0 : 1;
+}
+
+static void usage()
+{
+  fprintf(stderr,
+    "usage: IllutronB_render [-s sequence] [-b bars] [-t bpm] [-r 8000|16000] [-i] [-a] [-m mono|split|pan] out.wav\n"
+    "       IllutronB_render -c | -g\n"
+    "  -s  original, amen, your or your2 - or 1 to 4 as the buttons on the board (default original)\n"
+    "  -b  number of bars of 16 steps to render (default 4)\n"
+    "  -t  beats per minute, 1 to 255 (default 120)\n"
+    "  -r  sample rate of the WAV file (default 8000, the synth update rate)\n"
+    "  -i  turn on wave table interpolation for all of the voices\n"
+    "  -a  play the demo song from Song.h, starting with the sequence from -s\n"
+    "  -m  mono (default) for one output, split or pan for both outputs in a stereo WAV file\n"
+    "  -c  check the regression scenarios against IllutronB_golden.h\n"
+    "  -g  print the hashes of the regression scenarios for IllutronB_golden.h\n");
+}
+
+int main(int argc,char **argv)
+{
+  CFlashSequence *pSequence = &originalSequence;
+  unsigned long ulBars = 4;
+  unsigned long ulBPM = 120;
+  unsigned long ulSampleRate = UPDATE_RATE;
+  const char *pFileName = NULL;
+  bool bInterpolate = false;
+  bool bSong = false;
+  int nOutputMode = -1;
+
+  for(int nArg = 1;nArg < argc;nArg++)
+  {
+    const char *pArg = argv[nArg];
+
+    if((0 == strcmp(pArg,"-c")) || (0 == strcmp(pArg,"-g")))
+    {
+      return checkScenarios('g' == pArg[1]);
+    }
+
+    if(0 == strcmp(pArg,"-i"))
+    {
+      bInterpolate = true;
+      continue;
+    }
+
+    if(0 == strcmp(pArg,"-a"))
+    {
+      bSong = true;
+      continue;
+    }
+
+    const char *pValue = (nArg + 1 < argc) ? argv[nArg + 1] : NULL;
+
+    if(('-' == pArg[0]) && (NULL == pValue))
+    {
+      usage();
+      return 1;
+    }
+
+    if(0 == strcmp(pArg,"-s"))
+    {
+      pSequence = findSequence(pValue);
+      nArg++;
+    }
+    else if(0 == strcmp(pArg,"-b"))
+    {
+      ulBars = strtoul(pValue,NULL,10);
+      nArg++;
+    }
+    else if(0 == strcmp(pArg,"-t"))
+    {
+      ulBPM = strtoul(pValue,NULL,10);
+      nArg++;
+    }
+    else if(0 == strcmp(pArg,"-m"))
+    {
+      nOutputMode = (0 == strcmp(pValue,"mono")) ? CIllutronB::OUTPUT_MONO :
+                    (0 == strcmp(pValue,"split")) ? CIllutronB::OUTPUT_SPLIT :
+                    (0 == strcmp(pValue,"pan")) ? CIllutronB::OUTPUT_PAN : -1;
+      if(-1 == nOutputMode)
+      {
+        usage();
+        return 1;
+      }
+      nArg++;
+    }
+    else if(0 == strcmp(pArg,"-r"))
+    {
+      ulSampleRate = strtoul(pValue,NULL,10);
+      nArg++;
+    }
+    else if(('-' != pArg[0]) && (NULL == pFileName))
+    {
+      pFileName = pArg;
+    }
+    else
+    {
+      usage();
+      return 1;
+    }
+  }
+
+  if((NULL == pFileName) || (NULL == pSequence) || (0 == ulBars) ||
+     (ulBPM < 1) || (ulBPM > 255) || ((UPDATE_RATE != ulSampleRate) && ((2*UPDATE_RATE) != ulSampleRate)))
+  {
+    usage();
+    return 1;
+  }
+
+  CIllutronB synth;
+  setupVoices(synth);
+  for(uint8_t sVoice = 0;sVoice < CHANNEL_MAX;sVoice++)
+  {
+    synth.m_Voices[sVoice].setInterpolation(bInterpolate);
+  }
+
+  // only split and pan have anything different on output B, mono stays a mono WAV file
+  bool bStereo = (CIllutronB::OUTPUT_SPLIT == nOutputMode) || (CIllutronB::OUTPUT_PAN == nOutputMode);
+  if(bStereo)
+  {
+    synth.setOutputMode(nOutputMode);
+  }
+  if(CIllutronB::OUTPUT_PAN == nOutputMode)
+  {
+    panVoices(synth);
+  }
+
+  std::vector<int8_t> samples;
+  std::vector<int8_t> samplesB;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  renderSequence(synth,pSequence,ulBPM,ulBars*STEPS_PER_BAR,samples,bStereo ? &samplesB : NULL,bSong ? &song : NULL);
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  if(!writeWav(pFileName,samples,ulSampleRate,bStereo ? &samplesB : NULL))
+  {
+    fprintf(stderr,"IllutronB_render: could not write %s\n",pFileName);
+    return 1;
+  }
+
+  double dSeconds = std::chrono::duration<double>(end - start).count();
+  double dAudioSeconds = (double)samples.size() / UPDATE_RATE;
+  fprintf(stderr,"%lu samples, %.2f seconds of audio rendered in %.2f ms - %.0fx real time\n",
+    (unsigned long)samples.size(),dAudioSeconds,dSeconds * 1000.0,(dSeconds > 0.0) ? dAudioSeconds / dSeconds : 0.0);
+
+  return 0;
+}
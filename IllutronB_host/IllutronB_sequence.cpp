@@ -0,0 +1,203 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// IllutronB sequence packer
+//
+// Turns the pattern grids in AmenBreakTracks.h into the lists of notes in AmenBreakFlash.h which the sketch plays
+// from flash with CFlashSequence. Run it after changing a pattern.
+//
+// Each step of each channel with a note becomes two bytes, see SEQUENCE_EVENT in AmenBreak.h. Before writing anything
+// the lists are played back through CFlashSequence and compared step by step with the grid through CSequence, so the
+// header is only written if the sketch will play exactly the same notes as before.
+//
+// Build from this folder with -
+//
+//   g++ -O2 -I../IllutronB_toby_rev2_v08_4 -o IllutronB_sequence IllutronB_sequence.cpp
+//
+// and run with -
+//
+//   ./IllutronB_sequence             - write AmenBreakFlash.h into ../IllutronB_toby_rev2_v08_4
+//   ./IllutronB_sequence folder      - write it somewhere else
+//
+// The output only depends on the patterns, so running it again gives exactly the same header.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "IllutronB.h"
+
+#include "AmenBreakTracks.h"
+#include "AmenBreak.h"
+
+#define TRACK_COUNT 4
+
+struct STracks
+{
+  const char *pName;         // the name of the grid in AmenBreakTracks.h
+  const char *pFlashName;    // the name of the list of notes in AmenBreakFlash.h
+  unsigned char *pTracks;    // the grid, TRACK_COUNT rows of sLength steps
+  unsigned char sLength;
+};
+
+static const STracks sTracks[] =
+{
+  {"originalTrack","originalTrackFlash",originalTrack[0],32},
+  {"amenBreak","amenBreakFlash",amenBreak[0],64},
+  {"yourTrack","yourTrackFlash",yourTrack[0],64},
+  {"yourTrack2","yourTrack2Flash",yourTrack2[0],128},
+};
+
+#define TRACKS_COUNT (sizeof(sTracks)/sizeof(sTracks[0]))
+
+// Every note in step order and channel order within a step, as the first and second bytes of each event
+static void packTracks(const STracks &tracks,std::vector<unsigned char> &events)
+{
+  unsigned char sLastStep = 0;
+  for(unsigned int unStep = 0;unStep < tracks.sLength;unStep++)
+  {
+    for(unsigned char sChannel = 0;sChannel < TRACK_COUNT;sChannel++)
+    {
+      unsigned char sNote = tracks.pTracks[(sChannel*tracks.sLength) + unStep];
+      if(0 == sNote)
+      {
+        continue;
+      }
+      // bridge a long gap with notes that play nothing
+      while((unStep - sLastStep) > SEQUENCE_DELTA_MAX)
+      {
+        events.push_back(SEQUENCE_EVENT(SEQUENCE_DELTA_MAX,0));
+        events.push_back(0);
+        sLastStep += SEQUENCE_DELTA_MAX;
+      }
+      events.push_back(SEQUENCE_EVENT(unStep - sLastStep,sChannel));
+      events.push_back(sNote);
+      sLastStep = unStep;
+    }
+  }
+}
+
+static bool checkStep(const STracks &tracks,CSequence &grid,CFlashSequence &flash,unsigned int unStep,const char *pHow)
+{
+  STriggers triggers = flash.getTriggers(unStep);
+  for(unsigned char sChannel = 0;sChannel < TRACK_COUNT;sChannel++)
+  {
+    if(grid.getTrigger(sChannel,unStep) != triggers.sNotes[sChannel])
+    {
+      fprintf(stderr,"IllutronB_sequence: %s step %u channel %d does not match %s\n",tracks.pName,unStep,sChannel,pHow);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Play both versions of the sequence twice round, the second time checks that the cursor goes back to the start. Then
+// ask for steps the way the sketch can when a button starts a sequence again part way through - each step twice, then
+// the step before it and the step itself again, and every step after every other step.
+// Returns false if any step of any channel is different.
+static bool checkTracks(const STracks &tracks,const std::vector<unsigned char> &events)
+{
+  CSequence grid(&tracks.pTracks[0],&tracks.pTracks[tracks.sLength],&tracks.pTracks[2*tracks.sLength],&tracks.pTracks[3*tracks.sLength],tracks.sLength);
+  CFlashSequence flash(events.data(),events.size()/2,tracks.sLength);
+  for(int nPass = 0;nPass < 2;nPass++)
+  {
+    for(unsigned int unStep = 0;unStep < tracks.sLength;unStep++)
+    {
+      for(unsigned char sChannel = 0;sChannel < TRACK_COUNT;sChannel++)
+      {
+        if(grid.getTrigger(sChannel,unStep) != flash.getTrigger(sChannel,unStep))
+        {
+          fprintf(stderr,"IllutronB_sequence: %s step %u channel %d does not match\n",tracks.pName,unStep,sChannel);
+          return false;
+        }
+      }
+    }
+  }
+
+  for(unsigned int unStep = 0;unStep < tracks.sLength;unStep++)
+  {
+    if(!checkStep(tracks,grid,flash,unStep,"the first time") ||
+       !checkStep(tracks,grid,flash,unStep,"asked for twice") ||
+       !checkStep(tracks,grid,flash,(unStep > 0) ? unStep - 1 : 0,"going back a step") ||
+       !checkStep(tracks,grid,flash,unStep,"after going back a step"))
+    {
+      return false;
+    }
+  }
+
+  for(unsigned int unFrom = 0;unFrom < tracks.sLength;unFrom++)
+  {
+    for(unsigned int unTo = 0;unTo < tracks.sLength;unTo++)
+    {
+      if(!checkStep(tracks,grid,flash,unFrom,"jumping from another step") ||
+         !checkStep(tracks,grid,flash,unTo,"jumping to another step"))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static bool writeHeader(const std::string &path,const std::vector<unsigned char> *pEvents)
+{
+  FILE *pFile = fopen(path.c_str(),"w");
+  if(NULL == pFile)
+  {
+    return false;
+  }
+
+  fprintf(pFile,"#ifndef _AMEN_BREAK_FLASH_\n#define _AMEN_BREAK_FLASH_\n\n");
+  fprintf(pFile,"// The patterns from AmenBreakTracks.h as lists of notes for CFlashSequence - made by IllutronB_host/IllutronB_sequence, do not edit.\n");
+  fprintf(pFile,"// Each note is SEQUENCE_EVENT(steps since the last note,channel) then the note, see AmenBreak.h\n");
+  for(size_t unTracks = 0;unTracks < TRACKS_COUNT;unTracks++)
+  {
+    const std::vector<unsigned char> &events = pEvents[unTracks];
+    fprintf(pFile,"\n// %s - %d steps, %d notes in %d bytes rather than %d\n",sTracks[unTracks].pName,sTracks[unTracks].sLength,
+      (int)events.size()/2,(int)events.size(),TRACK_COUNT*sTracks[unTracks].sLength);
+    fprintf(pFile,"PROGMEM const unsigned char %s[]=\n{\n",sTracks[unTracks].pFlashName);
+    unsigned int unStep = 0;
+    for(size_t unEvent = 0;unEvent < events.size();unEvent += 2)
+    {
+      unStep += events[unEvent]>>2;
+      fprintf(pFile,"\tSEQUENCE_EVENT(%d,%d),0%02o,\t//step %u\n",events[unEvent]>>2,events[unEvent] & 3,events[unEvent + 1],unStep);
+    }
+    fprintf(pFile,"};\n");
+  }
+  fprintf(pFile,"\n#endif\n");
+
+  return 0 == fclose(pFile);
+}
+
+int main(int argc,char **argv)
+{
+  if(argc > 2)
+  {
+    fprintf(stderr,"usage: IllutronB_sequence [folder]\n");
+    return 1;
+  }
+  std::string folder = (argc == 2) ? argv[1] : "../IllutronB_toby_rev2_v08_4";
+
+  std::vector<unsigned char> events[TRACKS_COUNT];
+  for(size_t unTracks = 0;unTracks < TRACKS_COUNT;unTracks++)
+  {
+    packTracks(sTracks[unTracks],events[unTracks]);
+    if(!checkTracks(sTracks[unTracks],events[unTracks]))
+    {
+      return 1;
+    }
+  }
+
+  std::string path = folder + "/AmenBreakFlash.h";
+  if(!writeHeader(path,events))
+  {
+    fprintf(stderr,"IllutronB_sequence: could not write %s\n",path.c_str());
+    return 1;
+  }
+  printf("wrote %s\n",path.c_str());
+
+  return 0;
+}
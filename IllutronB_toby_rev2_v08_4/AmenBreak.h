@@ -1,156 +1,157 @@
 
-// Noten werden Octal mit 127 schritten eingegeben 0-127 decimal = 0-177 Octal
-
-unsigned char originalTrack[CHANNEL_MAX][32]=             //Button 1
-{  
- // played by Channel 0 - Button 1
-   {001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000, /*|*/ 001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000},   
- // played by Channel 1 - Button 2 pitchshift = pot2
-   {047,000,000,041, 000,000,044,000, 044,000,000,046, 000,000,041,000, /*|*/ 047,000,000,041, 000,000,044,000, 000,044,000,046, 000,000,051,000},   
- // played by Channel 2 - Button 3 pitchshift = shift + pot2
-   {000,000,000,050, 000,000,000,000, 000,000,000,050, 000,000,000,000, /*|*/ 000,000,000,050, 000,000,000,000, 000,000,000,050, 000,000,000,000},   
- // Played by channel 3 - Button 4
-   {000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, /*|*/ 000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000},   
-};
-
-
+// The sequences - the notes each channel plays on each step. CSequence plays a grid of steps straight from RAM, the
+// patterns themselves are written like that in AmenBreakTracks.h. The sketch plays them with CFlashSequence from the
+// copies in flash in AmenBreakFlash.h so that they do not use up our RAM.
 
+// The notes for all of the channels on one step, from getTriggers - 0 for no note. Getting them all together means the
+// sketch only looks up the sequence once for each step and only has to decide which sequence it is playing once.
+#define SEQUENCE_TRACKS 4
 
-/*
-http://en.wikipedia.org/wiki/Amen_break
-
-C | ---- ---- ---- ----                       | ---- ---- ---- ----                | ---- ---- ---- ----              |---- ---- --X- ----|
-R | x-x- x-x- x-x- x-x-                       | x-x- x-x- x-x- x-x-                | x-x- x-x- x-X- x-x-              |x-x- x-x- x--- x-x-|
-S | ---- o--o -o-- o--o                       | ---- o--o -o-- o--o                | ---- o--o -o-- --o-              |-o-- o--o -o-- --o-|
-B | o-o- ---- --oo ----                       | o-o- ---- --oo ----                | o-o- ---- --o- ----              |--oo ---- --o- ----|
-  | 1 +  2 +  3 +  4 +                        | 1 +  2 +  3 +  4 +                 | 1 +  2 +  3 +  4 +               |1 +  2 +  3 +  4 + |  
-*/
-unsigned char amenBreak[4][64] =             // Button 2
+struct STriggers
 {
-/* Button 1 */
-  {000,000,000,000, 000,000,000,000, 000,000,000,000, 000,000,000,000, /*|*/ 000,000,000,000, 000,000,000,000, 000,000,000,000, 000,000,000,000,  
-   000,000,000,000, 000,000,000,000, 000,000,000,000, 000,000,000,000, /*|*/ 000,000,000,000, 000,000,000,000, 000,000,001,000, 000,000,000,000 },
-/* Button 3       pitchshift = pot2  */ 
-  {070,000,070,000, 070,000,070,000, 070,000,070,000, 070,000,070,000, /*|*/ 070,000,070,000, 070,000,070,000, 070,000,070,000, 070,000,070,000, 
-   070,000,070,000, 070,000,070,000, 070,000,075,000, 070,000,070,000, /*|*/ 070,000,070,000, 070,000,070,000, 070,000,000,000, 070,000,070,000 },
-/* Button 2 40 -100 -- 270-700       pitchshift = shift + pot2 */
-  {000,000,000,000, 070,000,000,060, 000,060,000,000, 120,000,000,060, /*|*/ 000,000,000,000, 070,000,000,060, 000,060,000,000, 050,000,000,060, 
-   000,000,000,000, 070,000,000,060, 000,060,000,000, 000,000,050,000, /*|*/ 000,060,000,000, 070,000,000,060, 000,060,000,000, 000,000,050,000 },
-/* Button 4 */    
-  {001,000,001,000, 000,000,000,000, 000,000,001,001, 000,000,000,000, /*|*/ 001,000,001,000, 000,000,000,000, 000,000,001,001, 000,000,000,000, 
-   001,000,001,000, 000,000,000,000, 000,000,001,000, 000,000,000,000, /*|*/ 000,000,001,001, 000,000,000,000, 000,000,001,000, 000,000,000,000 },
+  unsigned char sNotes[SEQUENCE_TRACKS];
 };
 
-
-unsigned char yourTrack[4][64] =           // Button 3
-
-{
-/* Button 1 */
-   {001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000, /*|*/ 001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000,
-    001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000, /*|*/ 001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000},
-/* Button 2       pitchshift = pot2  */
-   {057,000,000,000, 057,000,000,000, 055,000,000,000, 057,000,000,000, /*|*/ 055,000,000,000, 057,000,000,000, 056,000,000,000, 057,000,000,000,
-    000,000,000,000, 057,000,000,000, 000,000,000,000, 057,000,000,000, /*|*/ 000,000,000,000, 055,000,000,000, 000,000,000,000, 057,000,000,000},
-/* Button 3 40 -100 -- 270-700       pitchshift = shift + pot2  */
-    {066,066,066,066, 066,066,066,066, 074,000,066,077, 000,066,077,000, /*|*/ 000,000,066,066, 075,000,066,073, 000,066,071,066, 000,077,076,000,
-     000,066,066,066, 066,066,066,066, 070,070,070,070, 000,070,070,070, /*|*/ 000,071,071,071, 071,071,071,071, 073,073,073,073, 000,073,071,073},
-/* Button 4 */  
-   {000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, /*|*/ 000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, 
-    000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, /*|*/ 000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000},
-};  
-
-
-unsigned char yourTrack2[4][128] =       // Button 4
+class CSequence
 {
-/* Button 1 */
-   {001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000, /*|*/ 001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000,
-    001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000, /*|*/ 001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000,
-    001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000, /*|*/ 001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000,
-    001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000, /*|*/ 001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000 },
-/* Button 3     pitchshift = pot2 */
-   {340,000,340,000, 340,000,000,000, 340,000,340,000, 340,000,000,000, /*|*/ 340,000,343,000, 336,000,000,338, 340,000,000,000, 000,000,000,000,
-    341,000,341,000, 341,000,000,341, 341,000,340,000, 340,000,340,340, /*|*/ 340,000,338,000, 338,000,340,000, 338,000,000,000, 343,000,000,000, 
-    340,000,340,000, 340,000,000,000, 340,000,340,000, 340,000,000,000, /*|*/ 340,000,343,000, 336,000,000,338, 340,000,000,000, 000,000,000,000,
-    341,000,341,000, 341,000,000,341, 341,000,340,000, 340,000,340,340, /*|*/ 343,000,343,000, 341,000,338,000, 336,000,000,000, 000,000,000,000},
-/* Button 2 40 -100 -- 270-700      pitchshift = shift + pot2 */
-   {340,000,340,000, 340,000,000,000, 340,000,340,000, 340,000,000,000, /*|*/ 340,000,343,000, 336,000,000,338, 340,000,000,000, 000,000,000,000,
-    341,000,341,000, 341,000,000,341, 341,000,340,000, 340,000,340,340, /*|*/ 340,000,338,000, 338,000,340,000, 338,000,000,000, 343,000,000,000, 
-    340,000,340,000, 340,000,000,000, 340,000,340,000, 340,000,000,000, /*|*/ 340,000,343,000, 336,000,000,338, 340,000,000,000, 000,000,000,000,
-    341,000,341,000, 341,000,000,341, 341,000,340,000, 340,000,340,340, /*|*/ 343,000,343,000, 341,000,338,000, 336,000,000,000, 000,000,000,000},
-/* Button 4 */  
-   {000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, /*|*/ 000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, 
-    000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, /*|*/ 000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000,
-    000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, /*|*/ 000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000,
-    000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, /*|*/ 000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000 },
-};    
-
+  public:
+    CSequence(unsigned char *pSequence0,unsigned char *pSequence1,unsigned char *pSequence2,unsigned char *pSequence3,unsigned char sLength)
+    {
+      m_pSequenceTracks[0] = pSequence0;
+      m_pSequenceTracks[1] = pSequence1;
+      m_pSequenceTracks[2] = pSequence2;
+      m_pSequenceTracks[3] = pSequence3;
+      m_sLength = sLength;
+    }
+    unsigned char getTrigger(unsigned char sChannel,unsigned char sBeat)
+    {
+      if((sBeat < m_sLength) && (sChannel < SEQUENCE_TRACKS) && (0 != m_pSequenceTracks[sChannel]))
+      {
+        return m_pSequenceTracks[sChannel][sBeat];
+      }
+      return 0;
+    }
+    STriggers getTriggers(unsigned char sBeat)
+    {
+      STriggers triggers;
+      for(unsigned char sChannel = 0;sChannel < SEQUENCE_TRACKS;sChannel++)
+      {
+        triggers.sNotes[sChannel] = getTrigger(sChannel,sBeat);
+      }
+      return triggers;
+    }
+    uint8_t getLength()
+    {
+      return m_sLength;
+    }
+  protected:
+    unsigned char *m_pSequenceTracks[SEQUENCE_TRACKS];
 
+    unsigned char m_sLength;
+};
 
-class CSequence
+// Each note of a flash sequence is two bytes - the number of steps since the previous note and the channel packed
+// into the first byte by SEQUENCE_EVENT, then the note. Notes on the same step follow each other with a delta of 0.
+// A gap longer than SEQUENCE_DELTA_MAX steps is bridged with a note 0 which plays nothing, just like a 000 in the grid.
+#define SEQUENCE_DELTA_MAX 63
+#define SEQUENCE_EVENT(delta,channel) (((delta)<<2)|(channel))
+
+// A sequence stored as a list of notes in flash. Most of the steps in our patterns are empty so the list is between a
+// half and a quarter of the size of the grid, but more importantly it takes no RAM at all - the four grids took 1152
+// bytes of our 2048.
+// It plays the same way as a CSequence - getTriggers gives the notes for every channel on a step, getTrigger just one.
+// Rather than search the list every time it keeps a cursor at the current step, the sketch asks for the steps one
+// after the other so the cursor moves forward a note or two each time. Asking for an earlier step (the
+// sequence starting again, or a button press starting it part way through a step) takes the cursor back to the start.
+// The cursor means one CFlashSequence should only be played from one place at a time, a copy has its own cursor.
+class CFlashSequence
 {
   public:
-    CSequence(unsigned char *pSequence0,unsigned char *pSequence1,unsigned char *pSequence2,unsigned char *pSequence3,unsigned char sLength)
+    CFlashSequence(const unsigned char *pEvents,uint16_t unEvents,unsigned char sLength)
     {
-      m_pSequenceTrack0 = pSequence0;
-      m_pSequenceTrack1 = pSequence1;
-      m_pSequenceTrack2 = pSequence2;
-      m_pSequenceTrack3 = pSequence3;
+      m_pEvents = pEvents;
+      m_unEvents = unEvents;
       m_sLength = sLength;
+      m_unCursor = 0;
+      m_sCursorStep = 0;
     }
     unsigned char getTrigger(unsigned char sChannel,unsigned char sBeat)
     {
-      unsigned char sTrigger = 0;
-      if(sBeat < m_sLength)
+      return (sChannel < SEQUENCE_TRACKS) ? getTriggers(sBeat).sNotes[sChannel] : 0;
+    }
+    STriggers getTriggers(unsigned char sBeat)
+    {
+      STriggers triggers = {{0,0,0,0}};
+      if(sBeat >= m_sLength)
+      {
+        return triggers;
+      }
+
+      // the cursor has passed every note up to m_sCursorStep, if we want one of those steps again start from the beginning
+      if((m_unCursor > 0) && (sBeat <= m_sCursorStep))
+      {
+        m_unCursor = 0;
+        m_sCursorStep = 0;
+      }
+
+      // move on past any notes before this step, m_sCursorStep is the step of the last note we passed
+      while(m_unCursor < m_unEvents)
+      {
+        unsigned char sStep = m_sCursorStep + (pgm_read_byte(&m_pEvents[m_unCursor*2])>>2);
+        if(sStep >= sBeat)
+        {
+          break;
+        }
+        m_sCursorStep = sStep;
+        m_unCursor++;
+      }
+
+      // then the notes on this step, there is at most one for each channel
+      unsigned char sStep = m_sCursorStep;
+      for(uint16_t unEvent = m_unCursor;unEvent < m_unEvents;unEvent++)
       {
-        switch(sChannel)
+        unsigned char sEvent = pgm_read_byte(&m_pEvents[unEvent*2]);
+        sStep += sEvent>>2;
+        if(sStep != sBeat)
         {
-          case 0:
-            if(m_pSequenceTrack0 != 0)
-             sTrigger = m_pSequenceTrack0[sBeat];
-             break;
-          case 1:
-            if(m_pSequenceTrack1 != 0)
-             sTrigger = m_pSequenceTrack1[sBeat];
-             break;
-          case 2:
-            if(m_pSequenceTrack2 != 0)
-             sTrigger = m_pSequenceTrack2[sBeat];
-             break;
-          case 3:
-            if(m_pSequenceTrack3 != 0)
-             sTrigger = m_pSequenceTrack3[sBeat];
-             break;
+          break;
         }
+        triggers.sNotes[sEvent & 3] = pgm_read_byte(&m_pEvents[(unEvent*2)+1]);
       }
-      return sTrigger;
+      return triggers;
     }
     uint8_t getLength()
     {
       return m_sLength;
     }
   protected:
-    unsigned char *m_pSequenceTrack0;
-    unsigned char *m_pSequenceTrack1;
-    unsigned char *m_pSequenceTrack2;
-    unsigned char *m_pSequenceTrack3;
-
+    const unsigned char *m_pEvents;
+    uint16_t m_unEvents;
     unsigned char m_sLength;
 
-   
+    uint16_t m_unCursor;           // the next note we have not passed
+    unsigned char m_sCursorStep;   // the step of the note before it, 0 at the start
 };
 
-// 11570
+#include "AmenBreakFlash.h"
 
-CSequence amenSequence(amenBreak[0],amenBreak[1],amenBreak[2],amenBreak[3],64);
-CSequence yourSequence(yourTrack[0],yourTrack[1],yourTrack[2],yourTrack[3],64);
-CSequence yourSequence2(yourTrack2[0],yourTrack2[1],yourTrack2[2],yourTrack2[3],128);
-CSequence originalSequence(originalTrack[0],originalTrack[1],originalTrack[2],originalTrack[3],32);
+#define FLASH_SEQUENCE(events,length) events,sizeof(events)/2,length
 
-CSequence *pCurrentSequence3  = &yourSequence;
-CSequence *pCurrentSequence4 = &yourSequence2;
-CSequence *pCurrentSequence1 = &originalSequence;
-CSequence *pCurrentSequence2 = &amenSequence;
+CFlashSequence amenSequence(FLASH_SEQUENCE(amenBreakFlash,64));
+CFlashSequence yourSequence(FLASH_SEQUENCE(yourTrackFlash,64));
+CFlashSequence yourSequence2(FLASH_SEQUENCE(yourTrack2Flash,128));
+CFlashSequence originalSequence(FLASH_SEQUENCE(originalTrackFlash,32));
 
+// The sequence for each of the buttons on the board, button 1 first. The sketch plays pCurrentSequence, choosing a
+// sequence is just pointing it at another one.
+#define SEQUENCE_BUTTONS 4
 
-  
+CFlashSequence *pButtonSequences[SEQUENCE_BUTTONS] =
+{
+  &originalSequence,
+  &amenSequence,
+  &yourSequence,
+  &yourSequence2,
+};
 
+CFlashSequence *pCurrentSequence = &originalSequence;
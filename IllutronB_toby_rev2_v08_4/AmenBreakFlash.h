@@ -0,0 +1,385 @@
+#ifndef _AMEN_BREAK_FLASH_
+#define _AMEN_BREAK_FLASH_
+
+// The patterns from AmenBreakTracks.h as lists of notes for CFlashSequence - made by IllutronB_host/IllutronB_sequence, do not edit.
+// Each note is SEQUENCE_EVENT(steps since the last note,channel) then the note, see AmenBreak.h
+
+// originalTrack - 32 steps, 32 notes in 64 bytes rather than 128
+PROGMEM const unsigned char originalTrackFlash[]=
+{
+	SEQUENCE_EVENT(0,0),001,	//step 0
+	SEQUENCE_EVENT(0,1),047,	//step 0
+	SEQUENCE_EVENT(2,3),001,	//step 2
+	SEQUENCE_EVENT(1,1),041,	//step 3
+	SEQUENCE_EVENT(0,2),050,	//step 3
+	SEQUENCE_EVENT(1,0),001,	//step 4
+	SEQUENCE_EVENT(2,1),044,	//step 6
+	SEQUENCE_EVENT(0,3),001,	//step 6
+	SEQUENCE_EVENT(2,0),001,	//step 8
+	SEQUENCE_EVENT(0,1),044,	//step 8
+	SEQUENCE_EVENT(2,3),001,	//step 10
+	SEQUENCE_EVENT(1,1),046,	//step 11
+	SEQUENCE_EVENT(0,2),050,	//step 11
+	SEQUENCE_EVENT(1,0),001,	//step 12
+	SEQUENCE_EVENT(2,1),041,	//step 14
+	SEQUENCE_EVENT(0,3),001,	//step 14
+	SEQUENCE_EVENT(2,0),001,	//step 16
+	SEQUENCE_EVENT(0,1),047,	//step 16
+	SEQUENCE_EVENT(2,3),001,	//step 18
+	SEQUENCE_EVENT(1,1),041,	//step 19
+	SEQUENCE_EVENT(0,2),050,	//step 19
+	SEQUENCE_EVENT(1,0),001,	//step 20
+	SEQUENCE_EVENT(2,1),044,	//step 22
+	SEQUENCE_EVENT(0,3),001,	//step 22
+	SEQUENCE_EVENT(2,0),001,	//step 24
+	SEQUENCE_EVENT(1,1),044,	//step 25
+	SEQUENCE_EVENT(1,3),001,	//step 26
+	SEQUENCE_EVENT(1,1),046,	//step 27
+	SEQUENCE_EVENT(0,2),050,	//step 27
+	SEQUENCE_EVENT(1,0),001,	//step 28
+	SEQUENCE_EVENT(2,1),051,	//step 30
+	SEQUENCE_EVENT(0,3),001,	//step 30
+};
+
+// amenBreak - 64 steps, 65 notes in 130 bytes rather than 256
+PROGMEM const unsigned char amenBreakFlash[]=
+{
+	SEQUENCE_EVENT(0,1),070,	//step 0
+	SEQUENCE_EVENT(0,3),001,	//step 0
+	SEQUENCE_EVENT(2,1),070,	//step 2
+	SEQUENCE_EVENT(0,3),001,	//step 2
+	SEQUENCE_EVENT(2,1),070,	//step 4
+	SEQUENCE_EVENT(0,2),070,	//step 4
+	SEQUENCE_EVENT(2,1),070,	//step 6
+	SEQUENCE_EVENT(1,2),060,	//step 7
+	SEQUENCE_EVENT(1,1),070,	//step 8
+	SEQUENCE_EVENT(1,2),060,	//step 9
+	SEQUENCE_EVENT(1,1),070,	//step 10
+	SEQUENCE_EVENT(0,3),001,	//step 10
+	SEQUENCE_EVENT(1,3),001,	//step 11
+	SEQUENCE_EVENT(1,1),070,	//step 12
+	SEQUENCE_EVENT(0,2),0170,	//step 12
+	SEQUENCE_EVENT(2,1),070,	//step 14
+	SEQUENCE_EVENT(1,2),060,	//step 15
+	SEQUENCE_EVENT(1,1),070,	//step 16
+	SEQUENCE_EVENT(0,3),001,	//step 16
+	SEQUENCE_EVENT(2,1),070,	//step 18
+	SEQUENCE_EVENT(0,3),001,	//step 18
+	SEQUENCE_EVENT(2,1),070,	//step 20
+	SEQUENCE_EVENT(0,2),070,	//step 20
+	SEQUENCE_EVENT(2,1),070,	//step 22
+	SEQUENCE_EVENT(1,2),060,	//step 23
+	SEQUENCE_EVENT(1,1),070,	//step 24
+	SEQUENCE_EVENT(1,2),060,	//step 25
+	SEQUENCE_EVENT(1,1),070,	//step 26
+	SEQUENCE_EVENT(0,3),001,	//step 26
+	SEQUENCE_EVENT(1,3),001,	//step 27
+	SEQUENCE_EVENT(1,1),070,	//step 28
+	SEQUENCE_EVENT(0,2),050,	//step 28
+	SEQUENCE_EVENT(2,1),070,	//step 30
+	SEQUENCE_EVENT(1,2),060,	//step 31
+	SEQUENCE_EVENT(1,1),070,	//step 32
+	SEQUENCE_EVENT(0,3),001,	//step 32
+	SEQUENCE_EVENT(2,1),070,	//step 34
+	SEQUENCE_EVENT(0,3),001,	//step 34
+	SEQUENCE_EVENT(2,1),070,	//step 36
+	SEQUENCE_EVENT(0,2),070,	//step 36
+	SEQUENCE_EVENT(2,1),070,	//step 38
+	SEQUENCE_EVENT(1,2),060,	//step 39
+	SEQUENCE_EVENT(1,1),070,	//step 40
+	SEQUENCE_EVENT(1,2),060,	//step 41
+	SEQUENCE_EVENT(1,1),075,	//step 42
+	SEQUENCE_EVENT(0,3),001,	//step 42
+	SEQUENCE_EVENT(2,1),070,	//step 44
+	SEQUENCE_EVENT(2,1),070,	//step 46
+	SEQUENCE_EVENT(0,2),050,	//step 46
+	SEQUENCE_EVENT(2,1),070,	//step 48
+	SEQUENCE_EVENT(1,2),060,	//step 49
+	SEQUENCE_EVENT(1,1),070,	//step 50
+	SEQUENCE_EVENT(0,3),001,	//step 50
+	SEQUENCE_EVENT(1,3),001,	//step 51
+	SEQUENCE_EVENT(1,1),070,	//step 52
+	SEQUENCE_EVENT(0,2),070,	//step 52
+	SEQUENCE_EVENT(2,1),070,	//step 54
+	SEQUENCE_EVENT(1,2),060,	//step 55
+	SEQUENCE_EVENT(1,1),070,	//step 56
+	SEQUENCE_EVENT(1,2),060,	//step 57
+	SEQUENCE_EVENT(1,0),001,	//step 58
+	SEQUENCE_EVENT(0,3),001,	//step 58
+	SEQUENCE_EVENT(2,1),070,	//step 60
+	SEQUENCE_EVENT(2,1),070,	//step 62
+	SEQUENCE_EVENT(0,2),050,	//step 62
+};
+
+// yourTrack - 64 steps, 95 notes in 190 bytes rather than 256
+PROGMEM const unsigned char yourTrackFlash[]=
+{
+	SEQUENCE_EVENT(0,0),001,	//step 0
+	SEQUENCE_EVENT(0,1),057,	//step 0
+	SEQUENCE_EVENT(0,2),066,	//step 0
+	SEQUENCE_EVENT(1,2),066,	//step 1
+	SEQUENCE_EVENT(1,2),066,	//step 2
+	SEQUENCE_EVENT(0,3),001,	//step 2
+	SEQUENCE_EVENT(1,2),066,	//step 3
+	SEQUENCE_EVENT(1,0),001,	//step 4
+	SEQUENCE_EVENT(0,1),057,	//step 4
+	SEQUENCE_EVENT(0,2),066,	//step 4
+	SEQUENCE_EVENT(1,2),066,	//step 5
+	SEQUENCE_EVENT(1,2),066,	//step 6
+	SEQUENCE_EVENT(0,3),001,	//step 6
+	SEQUENCE_EVENT(1,2),066,	//step 7
+	SEQUENCE_EVENT(1,0),001,	//step 8
+	SEQUENCE_EVENT(0,1),055,	//step 8
+	SEQUENCE_EVENT(0,2),074,	//step 8
+	SEQUENCE_EVENT(2,2),066,	//step 10
+	SEQUENCE_EVENT(0,3),001,	//step 10
+	SEQUENCE_EVENT(1,2),077,	//step 11
+	SEQUENCE_EVENT(1,0),001,	//step 12
+	SEQUENCE_EVENT(0,1),057,	//step 12
+	SEQUENCE_EVENT(1,2),066,	//step 13
+	SEQUENCE_EVENT(1,2),077,	//step 14
+	SEQUENCE_EVENT(0,3),001,	//step 14
+	SEQUENCE_EVENT(2,0),001,	//step 16
+	SEQUENCE_EVENT(0,1),055,	//step 16
+	SEQUENCE_EVENT(2,2),066,	//step 18
+	SEQUENCE_EVENT(0,3),001,	//step 18
+	SEQUENCE_EVENT(1,2),066,	//step 19
+	SEQUENCE_EVENT(1,0),001,	//step 20
+	SEQUENCE_EVENT(0,1),057,	//step 20
+	SEQUENCE_EVENT(0,2),075,	//step 20
+	SEQUENCE_EVENT(2,2),066,	//step 22
+	SEQUENCE_EVENT(0,3),001,	//step 22
+	SEQUENCE_EVENT(1,2),073,	//step 23
+	SEQUENCE_EVENT(1,0),001,	//step 24
+	SEQUENCE_EVENT(0,1),056,	//step 24
+	SEQUENCE_EVENT(1,2),066,	//step 25
+	SEQUENCE_EVENT(1,2),071,	//step 26
+	SEQUENCE_EVENT(0,3),001,	//step 26
+	SEQUENCE_EVENT(1,2),066,	//step 27
+	SEQUENCE_EVENT(1,0),001,	//step 28
+	SEQUENCE_EVENT(0,1),057,	//step 28
+	SEQUENCE_EVENT(1,2),077,	//step 29
+	SEQUENCE_EVENT(1,2),076,	//step 30
+	SEQUENCE_EVENT(0,3),001,	//step 30
+	SEQUENCE_EVENT(2,0),001,	//step 32
+	SEQUENCE_EVENT(1,2),066,	//step 33
+	SEQUENCE_EVENT(1,2),066,	//step 34
+	SEQUENCE_EVENT(0,3),001,	//step 34
+	SEQUENCE_EVENT(1,2),066,	//step 35
+	SEQUENCE_EVENT(1,0),001,	//step 36
+	SEQUENCE_EVENT(0,1),057,	//step 36
+	SEQUENCE_EVENT(0,2),066,	//step 36
+	SEQUENCE_EVENT(1,2),066,	//step 37
+	SEQUENCE_EVENT(1,2),066,	//step 38
+	SEQUENCE_EVENT(0,3),001,	//step 38
+	SEQUENCE_EVENT(1,2),066,	//step 39
+	SEQUENCE_EVENT(1,0),001,	//step 40
+	SEQUENCE_EVENT(0,2),070,	//step 40
+	SEQUENCE_EVENT(1,2),070,	//step 41
+	SEQUENCE_EVENT(1,2),070,	//step 42
+	SEQUENCE_EVENT(0,3),001,	//step 42
+	SEQUENCE_EVENT(1,2),070,	//step 43
+	SEQUENCE_EVENT(1,0),001,	//step 44
+	SEQUENCE_EVENT(0,1),057,	//step 44
+	SEQUENCE_EVENT(1,2),070,	//step 45
+	SEQUENCE_EVENT(1,2),070,	//step 46
+	SEQUENCE_EVENT(0,3),001,	//step 46
+	SEQUENCE_EVENT(1,2),070,	//step 47
+	SEQUENCE_EVENT(1,0),001,	//step 48
+	SEQUENCE_EVENT(1,2),071,	//step 49
+	SEQUENCE_EVENT(1,2),071,	//step 50
+	SEQUENCE_EVENT(0,3),001,	//step 50
+	SEQUENCE_EVENT(1,2),071,	//step 51
+	SEQUENCE_EVENT(1,0),001,	//step 52
+	SEQUENCE_EVENT(0,1),055,	//step 52
+	SEQUENCE_EVENT(0,2),071,	//step 52
+	SEQUENCE_EVENT(1,2),071,	//step 53
+	SEQUENCE_EVENT(1,2),071,	//step 54
+	SEQUENCE_EVENT(0,3),001,	//step 54
+	SEQUENCE_EVENT(1,2),071,	//step 55
+	SEQUENCE_EVENT(1,0),001,	//step 56
+	SEQUENCE_EVENT(0,2),073,	//step 56
+	SEQUENCE_EVENT(1,2),073,	//step 57
+	SEQUENCE_EVENT(1,2),073,	//step 58
+	SEQUENCE_EVENT(0,3),001,	//step 58
+	SEQUENCE_EVENT(1,2),073,	//step 59
+	SEQUENCE_EVENT(1,0),001,	//step 60
+	SEQUENCE_EVENT(0,1),057,	//step 60
+	SEQUENCE_EVENT(1,2),073,	//step 61
+	SEQUENCE_EVENT(1,2),071,	//step 62
+	SEQUENCE_EVENT(0,3),001,	//step 62
+	SEQUENCE_EVENT(1,2),073,	//step 63
+};
+
+// yourTrack2 - 128 steps, 166 notes in 332 bytes rather than 512
+PROGMEM const unsigned char yourTrack2Flash[]=
+{
+	SEQUENCE_EVENT(0,0),001,	//step 0
+	SEQUENCE_EVENT(0,1),0124,	//step 0
+	SEQUENCE_EVENT(0,2),0124,	//step 0
+	SEQUENCE_EVENT(2,1),0124,	//step 2
+	SEQUENCE_EVENT(0,2),0124,	//step 2
+	SEQUENCE_EVENT(0,3),001,	//step 2
+	SEQUENCE_EVENT(2,0),001,	//step 4
+	SEQUENCE_EVENT(0,1),0124,	//step 4
+	SEQUENCE_EVENT(0,2),0124,	//step 4
+	SEQUENCE_EVENT(2,3),001,	//step 6
+	SEQUENCE_EVENT(2,0),001,	//step 8
+	SEQUENCE_EVENT(0,1),0124,	//step 8
+	SEQUENCE_EVENT(0,2),0124,	//step 8
+	SEQUENCE_EVENT(2,1),0124,	//step 10
+	SEQUENCE_EVENT(0,2),0124,	//step 10
+	SEQUENCE_EVENT(0,3),001,	//step 10
+	SEQUENCE_EVENT(2,0),001,	//step 12
+	SEQUENCE_EVENT(0,1),0124,	//step 12
+	SEQUENCE_EVENT(0,2),0124,	//step 12
+	SEQUENCE_EVENT(2,3),001,	//step 14
+	SEQUENCE_EVENT(2,0),001,	//step 16
+	SEQUENCE_EVENT(0,1),0124,	//step 16
+	SEQUENCE_EVENT(0,2),0124,	//step 16
+	SEQUENCE_EVENT(2,1),0127,	//step 18
+	SEQUENCE_EVENT(0,2),0127,	//step 18
+	SEQUENCE_EVENT(0,3),001,	//step 18
+	SEQUENCE_EVENT(2,0),001,	//step 20
+	SEQUENCE_EVENT(0,1),0120,	//step 20
+	SEQUENCE_EVENT(0,2),0120,	//step 20
+	SEQUENCE_EVENT(2,3),001,	//step 22
+	SEQUENCE_EVENT(1,1),0122,	//step 23
+	SEQUENCE_EVENT(0,2),0122,	//step 23
+	SEQUENCE_EVENT(1,0),001,	//step 24
+	SEQUENCE_EVENT(0,1),0124,	//step 24
+	SEQUENCE_EVENT(0,2),0124,	//step 24
+	SEQUENCE_EVENT(2,3),001,	//step 26
+	SEQUENCE_EVENT(2,0),001,	//step 28
+	SEQUENCE_EVENT(2,3),001,	//step 30
+	SEQUENCE_EVENT(2,0),001,	//step 32
+	SEQUENCE_EVENT(0,1),0125,	//step 32
+	SEQUENCE_EVENT(0,2),0125,	//step 32
+	SEQUENCE_EVENT(2,1),0125,	//step 34
+	SEQUENCE_EVENT(0,2),0125,	//step 34
+	SEQUENCE_EVENT(0,3),001,	//step 34
+	SEQUENCE_EVENT(2,0),001,	//step 36
+	SEQUENCE_EVENT(0,1),0125,	//step 36
+	SEQUENCE_EVENT(0,2),0125,	//step 36
+	SEQUENCE_EVENT(2,3),001,	//step 38
+	SEQUENCE_EVENT(1,1),0125,	//step 39
+	SEQUENCE_EVENT(0,2),0125,	//step 39
+	SEQUENCE_EVENT(1,0),001,	//step 40
+	SEQUENCE_EVENT(0,1),0125,	//step 40
+	SEQUENCE_EVENT(0,2),0125,	//step 40
+	SEQUENCE_EVENT(2,1),0124,	//step 42
+	SEQUENCE_EVENT(0,2),0124,	//step 42
+	SEQUENCE_EVENT(0,3),001,	//step 42
+	SEQUENCE_EVENT(2,0),001,	//step 44
+	SEQUENCE_EVENT(0,1),0124,	//step 44
+	SEQUENCE_EVENT(0,2),0124,	//step 44
+	SEQUENCE_EVENT(2,1),0124,	//step 46
+	SEQUENCE_EVENT(0,2),0124,	//step 46
+	SEQUENCE_EVENT(0,3),001,	//step 46
+	SEQUENCE_EVENT(1,1),0124,	//step 47
+	SEQUENCE_EVENT(0,2),0124,	//step 47
+	SEQUENCE_EVENT(1,0),001,	//step 48
+	SEQUENCE_EVENT(0,1),0124,	//step 48
+	SEQUENCE_EVENT(0,2),0124,	//step 48
+	SEQUENCE_EVENT(2,1),0122,	//step 50
+	SEQUENCE_EVENT(0,2),0122,	//step 50
+	SEQUENCE_EVENT(0,3),001,	//step 50
+	SEQUENCE_EVENT(2,0),001,	//step 52
+	SEQUENCE_EVENT(0,1),0122,	//step 52
+	SEQUENCE_EVENT(0,2),0122,	//step 52
+	SEQUENCE_EVENT(2,1),0124,	//step 54
+	SEQUENCE_EVENT(0,2),0124,	//step 54
+	SEQUENCE_EVENT(0,3),001,	//step 54
+	SEQUENCE_EVENT(2,0),001,	//step 56
+	SEQUENCE_EVENT(0,1),0122,	//step 56
+	SEQUENCE_EVENT(0,2),0122,	//step 56
+	SEQUENCE_EVENT(2,3),001,	//step 58
+	SEQUENCE_EVENT(2,0),001,	//step 60
+	SEQUENCE_EVENT(0,1),0127,	//step 60
+	SEQUENCE_EVENT(0,2),0127,	//step 60
+	SEQUENCE_EVENT(2,3),001,	//step 62
+	SEQUENCE_EVENT(2,0),001,	//step 64
+	SEQUENCE_EVENT(0,1),0124,	//step 64
+	SEQUENCE_EVENT(0,2),0124,	//step 64
+	SEQUENCE_EVENT(2,1),0124,	//step 66
+	SEQUENCE_EVENT(0,2),0124,	//step 66
+	SEQUENCE_EVENT(0,3),001,	//step 66
+	SEQUENCE_EVENT(2,0),001,	//step 68
+	SEQUENCE_EVENT(0,1),0124,	//step 68
+	SEQUENCE_EVENT(0,2),0124,	//step 68
+	SEQUENCE_EVENT(2,3),001,	//step 70
+	SEQUENCE_EVENT(2,0),001,	//step 72
+	SEQUENCE_EVENT(0,1),0124,	//step 72
+	SEQUENCE_EVENT(0,2),0124,	//step 72
+	SEQUENCE_EVENT(2,1),0124,	//step 74
+	SEQUENCE_EVENT(0,2),0124,	//step 74
+	SEQUENCE_EVENT(0,3),001,	//step 74
+	SEQUENCE_EVENT(2,0),001,	//step 76
+	SEQUENCE_EVENT(0,1),0124,	//step 76
+	SEQUENCE_EVENT(0,2),0124,	//step 76
+	SEQUENCE_EVENT(2,3),001,	//step 78
+	SEQUENCE_EVENT(2,0),001,	//step 80
+	SEQUENCE_EVENT(0,1),0124,	//step 80
+	SEQUENCE_EVENT(0,2),0124,	//step 80
+	SEQUENCE_EVENT(2,1),0127,	//step 82
+	SEQUENCE_EVENT(0,2),0127,	//step 82
+	SEQUENCE_EVENT(0,3),001,	//step 82
+	SEQUENCE_EVENT(2,0),001,	//step 84
+	SEQUENCE_EVENT(0,1),0120,	//step 84
+	SEQUENCE_EVENT(0,2),0120,	//step 84
+	SEQUENCE_EVENT(2,3),001,	//step 86
+	SEQUENCE_EVENT(1,1),0122,	//step 87
+	SEQUENCE_EVENT(0,2),0122,	//step 87
+	SEQUENCE_EVENT(1,0),001,	//step 88
+	SEQUENCE_EVENT(0,1),0124,	//step 88
+	SEQUENCE_EVENT(0,2),0124,	//step 88
+	SEQUENCE_EVENT(2,3),001,	//step 90
+	SEQUENCE_EVENT(2,0),001,	//step 92
+	SEQUENCE_EVENT(2,3),001,	//step 94
+	SEQUENCE_EVENT(2,0),001,	//step 96
+	SEQUENCE_EVENT(0,1),0125,	//step 96
+	SEQUENCE_EVENT(0,2),0125,	//step 96
+	SEQUENCE_EVENT(2,1),0125,	//step 98
+	SEQUENCE_EVENT(0,2),0125,	//step 98
+	SEQUENCE_EVENT(0,3),001,	//step 98
+	SEQUENCE_EVENT(2,0),001,	//step 100
+	SEQUENCE_EVENT(0,1),0125,	//step 100
+	SEQUENCE_EVENT(0,2),0125,	//step 100
+	SEQUENCE_EVENT(2,3),001,	//step 102
+	SEQUENCE_EVENT(1,1),0125,	//step 103
+	SEQUENCE_EVENT(0,2),0125,	//step 103
+	SEQUENCE_EVENT(1,0),001,	//step 104
+	SEQUENCE_EVENT(0,1),0125,	//step 104
+	SEQUENCE_EVENT(0,2),0125,	//step 104
+	SEQUENCE_EVENT(2,1),0124,	//step 106
+	SEQUENCE_EVENT(0,2),0124,	//step 106
+	SEQUENCE_EVENT(0,3),001,	//step 106
+	SEQUENCE_EVENT(2,0),001,	//step 108
+	SEQUENCE_EVENT(0,1),0124,	//step 108
+	SEQUENCE_EVENT(0,2),0124,	//step 108
+	SEQUENCE_EVENT(2,1),0124,	//step 110
+	SEQUENCE_EVENT(0,2),0124,	//step 110
+	SEQUENCE_EVENT(0,3),001,	//step 110
+	SEQUENCE_EVENT(1,1),0124,	//step 111
+	SEQUENCE_EVENT(0,2),0124,	//step 111
+	SEQUENCE_EVENT(1,0),001,	//step 112
+	SEQUENCE_EVENT(0,1),0127,	//step 112
+	SEQUENCE_EVENT(0,2),0127,	//step 112
+	SEQUENCE_EVENT(2,1),0127,	//step 114
+	SEQUENCE_EVENT(0,2),0127,	//step 114
+	SEQUENCE_EVENT(0,3),001,	//step 114
+	SEQUENCE_EVENT(2,0),001,	//step 116
+	SEQUENCE_EVENT(0,1),0125,	//step 116
+	SEQUENCE_EVENT(0,2),0125,	//step 116
+	SEQUENCE_EVENT(2,1),0122,	//step 118
+	SEQUENCE_EVENT(0,2),0122,	//step 118
+	SEQUENCE_EVENT(0,3),001,	//step 118
+	SEQUENCE_EVENT(2,0),001,	//step 120
+	SEQUENCE_EVENT(0,1),0120,	//step 120
+	SEQUENCE_EVENT(0,2),0120,	//step 120
+	SEQUENCE_EVENT(2,3),001,	//step 122
+	SEQUENCE_EVENT(2,0),001,	//step 124
+	SEQUENCE_EVENT(2,3),001,	//step 126
+};
+
+#endif
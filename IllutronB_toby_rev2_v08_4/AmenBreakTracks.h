@@ -0,0 +1,96 @@
+#ifndef _AMEN_BREAK_TRACKS_
+#define _AMEN_BREAK_TRACKS_
+
+// The sequences as a grid of steps, one row for each channel - this is the place to write and change a pattern.
+// The sketch does not include this, these arrays would take about 1K of our 2K of RAM. It plays the same notes from
+// AmenBreakFlash.h which is made from these by IllutronB_host/IllutronB_sequence - run it again after changing a pattern.
+// A CSequence (see AmenBreak.h) can still play these straight from RAM, handy if a sketch wants to change a pattern as it plays.
+
+// Noten werden Octal mit 127 schritten eingegeben 0-127 decimal = 0-177 Octal
+
+unsigned char originalTrack[4][32]=             //Button 1
+{  
+ // played by Channel 0 - Button 1
+   {001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000, /*|*/ 001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000},   
+ // played by Channel 1 - Button 2 pitchshift = pot2
+   {047,000,000,041, 000,000,044,000, 044,000,000,046, 000,000,041,000, /*|*/ 047,000,000,041, 000,000,044,000, 000,044,000,046, 000,000,051,000},   
+ // played by Channel 2 - Button 3 pitchshift = shift + pot2
+   {000,000,000,050, 000,000,000,000, 000,000,000,050, 000,000,000,000, /*|*/ 000,000,000,050, 000,000,000,000, 000,000,000,050, 000,000,000,000},   
+ // Played by channel 3 - Button 4
+   {000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, /*|*/ 000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000},   
+};
+
+
+
+
+/*
+http://en.wikipedia.org/wiki/Amen_break
+
+C | ---- ---- ---- ----                       | ---- ---- ---- ----                | ---- ---- ---- ----              |---- ---- --X- ----|
+R | x-x- x-x- x-x- x-x-                       | x-x- x-x- x-x- x-x-                | x-x- x-x- x-X- x-x-              |x-x- x-x- x--- x-x-|
+S | ---- o--o -o-- o--o                       | ---- o--o -o-- o--o                | ---- o--o -o-- --o-              |-o-- o--o -o-- --o-|
+B | o-o- ---- --oo ----                       | o-o- ---- --oo ----                | o-o- ---- --o- ----              |--oo ---- --o- ----|
+  | 1 +  2 +  3 +  4 +                        | 1 +  2 +  3 +  4 +                 | 1 +  2 +  3 +  4 +               |1 +  2 +  3 +  4 + |  
+*/
+unsigned char amenBreak[4][64] =             // Button 2
+{
+/* Button 1 */
+  {000,000,000,000, 000,000,000,000, 000,000,000,000, 000,000,000,000, /*|*/ 000,000,000,000, 000,000,000,000, 000,000,000,000, 000,000,000,000,  
+   000,000,000,000, 000,000,000,000, 000,000,000,000, 000,000,000,000, /*|*/ 000,000,000,000, 000,000,000,000, 000,000,001,000, 000,000,000,000 },
+/* Button 3       pitchshift = pot2  */ 
+  {070,000,070,000, 070,000,070,000, 070,000,070,000, 070,000,070,000, /*|*/ 070,000,070,000, 070,000,070,000, 070,000,070,000, 070,000,070,000, 
+   070,000,070,000, 070,000,070,000, 070,000,075,000, 070,000,070,000, /*|*/ 070,000,070,000, 070,000,070,000, 070,000,000,000, 070,000,070,000 },
+/* Button 2 40 -100 -- 270-700       pitchshift = shift + pot2 */
+  {000,000,000,000, 070,000,000,060, 000,060,000,000, 120,000,000,060, /*|*/ 000,000,000,000, 070,000,000,060, 000,060,000,000, 050,000,000,060, 
+   000,000,000,000, 070,000,000,060, 000,060,000,000, 000,000,050,000, /*|*/ 000,060,000,000, 070,000,000,060, 000,060,000,000, 000,000,050,000 },
+/* Button 4 */    
+  {001,000,001,000, 000,000,000,000, 000,000,001,001, 000,000,000,000, /*|*/ 001,000,001,000, 000,000,000,000, 000,000,001,001, 000,000,000,000, 
+   001,000,001,000, 000,000,000,000, 000,000,001,000, 000,000,000,000, /*|*/ 000,000,001,001, 000,000,000,000, 000,000,001,000, 000,000,000,000 },
+};
+
+
+unsigned char yourTrack[4][64] =           // Button 3
+
+{
+/* Button 1 */
+   {001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000, /*|*/ 001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000,
+    001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000, /*|*/ 001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000},
+/* Button 2       pitchshift = pot2  */
+   {057,000,000,000, 057,000,000,000, 055,000,000,000, 057,000,000,000, /*|*/ 055,000,000,000, 057,000,000,000, 056,000,000,000, 057,000,000,000,
+    000,000,000,000, 057,000,000,000, 000,000,000,000, 057,000,000,000, /*|*/ 000,000,000,000, 055,000,000,000, 000,000,000,000, 057,000,000,000},
+/* Button 3 40 -100 -- 270-700       pitchshift = shift + pot2  */
+    {066,066,066,066, 066,066,066,066, 074,000,066,077, 000,066,077,000, /*|*/ 000,000,066,066, 075,000,066,073, 000,066,071,066, 000,077,076,000,
+     000,066,066,066, 066,066,066,066, 070,070,070,070, 000,070,070,070, /*|*/ 000,071,071,071, 071,071,071,071, 073,073,073,073, 000,073,071,073},
+/* Button 4 */  
+   {000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, /*|*/ 000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, 
+    000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, /*|*/ 000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000},
+};  
+
+
+// Channels 1 and 2 of yourTrack2 were written as 340, 341 ... which are decimal not octal and too big for an unsigned char
+// the compiler wrapped them round to 84, 85 ... (0124, 0125 ... octal) which is what the board has always played - so that is what is written here now
+unsigned char yourTrack2[4][128] =       // Button 4
+{
+/* Button 1 */
+   {001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000, /*|*/ 001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000,
+    001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000, /*|*/ 001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000,
+    001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000, /*|*/ 001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000,
+    001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000, /*|*/ 001,000,000,000, 001,000,000,000, 001,000,000,000, 001,000,000,000 },
+/* Button 3     pitchshift = pot2 */
+   {0124,000,0124,000, 0124,000,000,000, 0124,000,0124,000, 0124,000,000,000, /*|*/ 0124,000,0127,000, 0120,000,000,0122, 0124,000,000,000, 000,000,000,000,
+    0125,000,0125,000, 0125,000,000,0125, 0125,000,0124,000, 0124,000,0124,0124, /*|*/ 0124,000,0122,000, 0122,000,0124,000, 0122,000,000,000, 0127,000,000,000, 
+    0124,000,0124,000, 0124,000,000,000, 0124,000,0124,000, 0124,000,000,000, /*|*/ 0124,000,0127,000, 0120,000,000,0122, 0124,000,000,000, 000,000,000,000,
+    0125,000,0125,000, 0125,000,000,0125, 0125,000,0124,000, 0124,000,0124,0124, /*|*/ 0127,000,0127,000, 0125,000,0122,000, 0120,000,000,000, 000,000,000,000},
+/* Button 2 40 -100 -- 270-700      pitchshift = shift + pot2 */
+   {0124,000,0124,000, 0124,000,000,000, 0124,000,0124,000, 0124,000,000,000, /*|*/ 0124,000,0127,000, 0120,000,000,0122, 0124,000,000,000, 000,000,000,000,
+    0125,000,0125,000, 0125,000,000,0125, 0125,000,0124,000, 0124,000,0124,0124, /*|*/ 0124,000,0122,000, 0122,000,0124,000, 0122,000,000,000, 0127,000,000,000, 
+    0124,000,0124,000, 0124,000,000,000, 0124,000,0124,000, 0124,000,000,000, /*|*/ 0124,000,0127,000, 0120,000,000,0122, 0124,000,000,000, 000,000,000,000,
+    0125,000,0125,000, 0125,000,000,0125, 0125,000,0124,000, 0124,000,0124,0124, /*|*/ 0127,000,0127,000, 0125,000,0122,000, 0120,000,000,000, 000,000,000,000},
+/* Button 4 */  
+   {000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, /*|*/ 000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, 
+    000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, /*|*/ 000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000,
+    000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, /*|*/ 000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000,
+    000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000, /*|*/ 000,000,001,000, 000,000,001,000, 000,000,001,000, 000,000,001,000 },
+};    
+
+#endif
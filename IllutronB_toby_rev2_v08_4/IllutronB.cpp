@@ -1,6 +1,18 @@
 
 #ifndef ILLUTRONB
-#include "illutronB.h"
+#include "IllutronB.h"
+#endif
+
+#if defined(ILLUTRONB_SIMD)
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 #endif
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,71 +43,51 @@
 //
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 
-// Bitwise operations - set bit, clear bit, check bit, toggle bit
-// TODO - there must be standard Arduino definitions for these, if so replace the these and use the standard versions
-#define SET(x,y) (x |=(1<<y))		        					//-Bit set/clear macros
-#define CLR(x,y) (x &= (~(1<<y)))       						// |
-#define CHK(x,y) (x & (1<<y))           						// |
-#define TOG(x,y) (x^=(1<<y))            						//-+
-
-// This stores a look up table from midi note numbers to frequencies in Hz
-// TODO - I am not convinced that the forumla is correct, and I do not beleive this should
-// be in run time memory, a better idea is to calculate the mapping once and store
-// it in progmem along with the wave tables and envelope tables.
-// will move it once someone has confirmed the accuracy or not of the calculations.
-unsigned int PITCHS[128];
-
-// We use two timers to generate the sound - Timer1 provides an interrupt 8000 times a second which we use to update output
-// The output itself is through PWM using timer 0 on digital pin 6 - it is incredible that this much sound and variety of sound
-// is possible through 8 bit PWM.
-
-// This is triggered 8000 times a second, we call the CIllutronB::OCR1A_ISR() function to update the output
-// TODO consider renaming OCR1A_ISR to update ?
-// TODO Timer1 is a 16 bit timer used by the servo library among others - should look at using a less valuable 8-bit timer instead.
-SIGNAL(TIMER1_COMPA_vect)
-{
-  CIllutronB::OCR1A_ISR();
-}
-
-// Setup up the timers - 
-// TODO - rename start and provide a stop function which will free up the timers
-// allowing the synth to be used periodically within a project which requires the timers
-// at other times.
-void CIllutronB::initSynth()
-{
-  // Set up Timer 1 output compare interrupt A
-  // Timer 1 is basically used as a scheduler that triggers at a regular interval for use to update the synth outputs.
-  TCCR1B=0x02;          // set the timer prescaler to 8 = 16/8 = 2MHz
-  SET(TIMSK1,OCIE1A);   // Enable output compare match interrupt on OCR1A
-  sei();
-  
-  // Set up the output timer - At the risk of repeating myself, it is incredible that the full sound range of the IllutronB
-  // is possible through the PWM output of just this one 8 bit timer.
-  TCCR0A=0B10110011;                                    //-8 bit audio PWM
-  //TCCR0A=0x83;          // Set timer waveform generation mode to FAST PWM, clear OC0A On match, set at bottom - OC0A = digital pin 6.
-  TCCR0B=0x01;          // Set to clock frequency, no prescaler
-  OCR0B = OCR0A=127;            // set in the middle - do we need this ? probably not.
-  SET(DDRD,5);          // Set digital pin 5 to output - channels 0 and 1
-  SET(DDRD,6);          // Set digital pin 6 to output - channels 2 and 3
+// The look up table from midi note numbers to wave phase increments is stored in program memory
+// along with the wave tables and envelope tables - see midi128.h
+// TODO - I am not convinced that the forumla is correct, will revisit once someone has confirmed the accuracy or not of the calculations.
+#include "midi128.h"
 
-  
-  // see related comments at the definition of PITCHS - dont like this approach, will change it in future.
-  for(unsigned char i=0;i<128;i++)
-  { 
-    // 440 is A4 on the piano 
-    PITCHS[i]=(440. * exp(.057762265 * (i - 69.)))/(SAMPLE_RATE/65535.0);
-    // Serial.println(PITCHS[i]);    
+// midi notes are 0-127, the sketch can push a note out of this range by adding a pitch offset so we wrap it back into the table
+// rather than reading past the end of it.
+static uint16_t getMidiPitch(unsigned char note)
+{
+  return pgm_read_word(&MidiPitchTable[note & 0x7F]);
+}
+
+// A new synth is silent with no tempo set, the voices need to be set up before they can play - see CVoice::setup
+CIllutronB::CIllutronB()
+{
+  // each voice sends its commands to this synth, tagged with its voice number
+  for(uint8_t sVoice = 0;sVoice < CHANNEL_MAX;sVoice++)
+  {
+    m_Voices[sVoice].m_pSynth = this;
+    m_Voices[sVoice].m_sVoice = sVoice;
   }
+  reset();
 }
 
 // Sets the beats per minute, the beatComplete function will return 
 // true whenever a beat is complete
 // TODO - Will need revisision - do sequencers normally operate on whole beats, quarter beats, sixteenths ?
+// The new tempo starts with the next beat, the beat we are part way through keeps its length. The demo sketch calls
+// setBPM on every beat, if we restarted the count the beats would move by however far render had got past the beat.
+// The first call starts the beat counter.
+// Each beat is four steps of the sequence, so a step is (UPDATE_RATE*60)/(sBPM*4) samples - 120000/sBPM. That is one
+// 32 bit by 8 bit divide, around 600 cycles on the AVR whatever the tempo, where the float version took two float divides
+// and a conversion, well over a thousand. It gives the same step as the float version at every tempo but 125 and 250 beats
+// per minute, where the float rounding came out one sample short and this is exact. Below 2 beats per minute a step does
+// not fit in 16 bits, so that is as slow as it goes - 0 is taken as 1 rather than dividing by zero.
 void CIllutronB::setBPM(uint8_t sBPM)
 {
-  m_unBPMCounterStart = (UPDATE_RATE/((float)sBPM/60.0))/4.0;
-  m_unBPMCounter = m_unBPMCounterStart;
-  m_sBeatComplete = false;
+  uint32_t ulBPMCounterStart = ((uint32_t)UPDATE_RATE*60/4)/((0 == sBPM) ? 1 : sBPM);
+  uint16_t unBPMCounterStart = (ulBPMCounterStart > 0xFFFF) ? 0xFFFF : ulBPMCounterStart;
+  if(0 == m_unBPMCounterStart)
+  {
+    m_unBPMCounter = unBPMCounterStart;
+    m_sBeatComplete = false;
+  }
+  m_unBPMCounterStart = unBPMCounterStart;
 }
 
 // tests the beat complete flag to see if the last beat is finished and a new one should be send
@@ -110,41 +102,149 @@ unsigned char CIllutronB::beatComplete()
   return oldBeatComplete;
 }
 
-// This is where all the work happens - or used to 
-// I have introduced the CIllutronB::CVoice class to make this easier to understand it still contains all of the work
-// but calls members of CIllutronB::CVoice to do a lot of the work on its behalf.
-//
-// This function runs 8000 times a second and updates the PWM frequency of digital pin 6 each time based on 
-// the output from the four voices which it mixes together to form a single output.
-void CIllutronB::OCR1A_ISR()
+// reset works on the render state directly rather than through the command queue, so do not call it while render
+// is running - on the Arduino call it before initSynth.
+void CIllutronB::reset()
 {
-  OCR1A+=(TIMER1_FREQUENCY/UPDATE_RATE); // set timer to come back for the next update in 125us time
-  // figure out which updates we need to perform
-  uint8_t bUpdateEnvelope = false;
-  if(0 == m_sEnvelopeDivider)
+  for(uint8_t sVoice = 0;sVoice < CHANNEL_MAX;sVoice++)
   {
-    m_sEnvelopeDivider = ENVELOPE_DIVIDER;
-    bUpdateEnvelope = true;
+    resetVoice(sVoice);
+    m_Voices[sVoice].m_sAmplitude = 0;
   }
-  else
-  {
-    m_sEnvelopeDivider--;
-  }
-  
-  //************************************************
-  //  Pitch Modulation Engine
-  //************************************************
-  // Again, like the envelope we do not update this every time, we use a divider
-  uint8_t bApplyEnvelopePitchModulation = (0 == m_unEnvelopePitchModulationDivider);
-  if(0 == bApplyEnvelopePitchModulation)
+  m_sCommandRead = 0;
+  m_sCommandWrite = 0;
+  m_sCommandPut = 0;
+  m_unBPMCounterStart = 0;
+  m_unBPMCounter = 0;
+  m_sBeatComplete = false;
+  m_sEnvelopeDivider = ENVELOPE_DIVIDER;
+  m_sEventRead = 0;
+  m_sEventWrite = 0;
+  m_ulSampleTime = 0;
+  m_unModulationCounter = 0;
+  m_sOutputMode = OUTPUT_MONO;
+}
+
+// the beat counter counts down to 0 and completes a beat when it gets there, a counter of 0 has to roll over first
+uint32_t CIllutronB::getSamplesToBeat()
+{
+  uint16_t unBPMCounter = m_unBPMCounter;
+  return (0 == unBPMCounter) ? 65536UL : unBPMCounter;
+}
+
+uint32_t CIllutronB::getSampleTime()
+{
+  return m_ulSampleTime;
+}
+
+uint32_t CIllutronB::getNextBeatTime()
+{
+  return m_ulSampleTime + getSamplesToBeat();
+}
+
+bool CIllutronB::queueTrigger(uint32_t ulTime, uint8_t sVoice)
+{
+  return queueEvent(ulTime,sVoice,EVENT_TRIGGER,0);
+}
+
+bool CIllutronB::queueMidi(uint32_t ulTime, uint8_t sVoice, unsigned char sNote)
+{
+  return queueEvent(ulTime,sVoice,EVENT_MIDI,sNote);
+}
+
+bool CIllutronB::queueEvent(uint32_t ulTime, uint8_t sVoice, uint8_t sType, unsigned char sNote)
+{
+  if((sVoice >= CHANNEL_MAX) || ((uint8_t)(m_sEventWrite - ILLUTRONB_QUEUE_LOAD(m_sEventRead)) >= EVENT_QUEUE_SIZE))
   {
-   m_unEnvelopePitchModulationDivider = MODULATION_PITCH_DIVIDER;
+    return false;
   }
-  else
+  SEvent &event = m_Events[m_sEventWrite & (EVENT_QUEUE_SIZE-1)];
+  event.ulTime = ulTime;
+  event.sVoice = sVoice;
+  event.sType = sType;
+  event.sNote = sNote;
+  // hand the note over to render once it is all there
+  ILLUTRONB_QUEUE_STORE(m_sEventWrite,(uint8_t)(m_sEventWrite + 1));
+  return true;
+}
+
+// This is where all the work happens - or used to 
+// I have introduced the CIllutronB::CVoice class to make this easier to understand it still contains all of the work
+// but calls members of CIllutronB::CVoice to do a lot of the work on its behalf.
+//
+// The synth runs at 8000 samples a second, this function is called by the AVR backend (IllutronB_avr.cpp) to calculate the 
+// next 'frames' outputs from the four voices which it mixes together to form a single output.
+// It does not touch any hardware so it can also be called from a host build.
+//
+// Originally the ISR calculated one sample at a time, now we calculate a block of samples in one go.
+// The work that is done once per sample - checking the dividers, reading the voice configuration from memory - is now done
+// once per block and each voice is able to keep its state in registers while it works through the block.
+//
+// Queued notes are started here, a block is ended early at the time of the next queued note so that the note
+// starts on the first sample of the following block - which is exactly the sample it was queued for.
+void CIllutronB::render(int8_t *pOut, size_t frames)
+{
+  render(pOut,NULL,frames);
+}
+
+// pOutB can be NULL if only output A is wanted, output B is then worked out (in split and pan modes) but thrown away
+void CIllutronB::render(int8_t *pOutA, int8_t *pOutB, size_t frames)
+{
+  while(frames)
   {
-    m_unEnvelopePitchModulationDivider--;
+    uint8_t sFrames = (frames > RENDER_BLOCK_MAX) ? RENDER_BLOCK_MAX : frames;
+
+    // pick up any setups and triggers the sketch has sent since the last block
+    syncVoices();
+
+    // bend the pitches every MODULATION_PITCH_DIVIDER samples, a block is ended early so that it never runs past an update
+    if(0 == m_unModulationCounter)
+    {
+      modulatePitch();
+      m_unModulationCounter = MODULATION_PITCH_DIVIDER;
+    }
+    if(m_unModulationCounter < sFrames)
+    {
+      sFrames = m_unModulationCounter;
+    }
+
+    while(m_sEventRead != ILLUTRONB_QUEUE_LOAD(m_sEventWrite))
+    {
+      const SEvent &event = m_Events[m_sEventRead & (EVENT_QUEUE_SIZE-1)];
+      // the difference is signed so that this still works when the sample time wraps around, after about 6 days
+      int32_t lSamplesToEvent = (int32_t)(event.ulTime - m_ulSampleTime);
+      if(lSamplesToEvent > 0)
+      {
+        if(lSamplesToEvent < sFrames)
+        {
+          sFrames = lSamplesToEvent;
+        }
+        break;
+      }
+
+      // its time (or past time) for this note, we are render so we can start it straight away rather than going through the command queue
+      if(EVENT_MIDI == event.sType)
+      {
+        m_VoiceState.unPitch[event.sVoice] = getMidiPitch(event.sNote);
+      }
+      startNote(event.sVoice);
+      ILLUTRONB_QUEUE_STORE(m_sEventRead,(uint8_t)(m_sEventRead + 1));
+    }
+
+    renderBlock(pOutA,pOutB,sFrames);
+    m_ulSampleTime += sFrames;
+    m_unModulationCounter -= sFrames;
+    pOutA += sFrames;
+    if(NULL != pOutB)
+    {
+      pOutB += sFrames;
+    }
+    frames -= sFrames;
   }
-  
+}
+
+void CIllutronB::renderBlock(int8_t *pOutA, int8_t *pOutB, uint8_t sFrames)
+{
   //-------------------------------
   //  Synthesizer/audio mixer
   //-------------------------------
@@ -154,7 +254,7 @@ void CIllutronB::OCR1A_ISR()
   // There is a little more to it, each of the channels has an output as big as the range that our single output
   // timer allows so we need to scale them to fit into this range, how ? divide by four, thats it, four 8 bit channels
   // added together, divided by four and sent to our 8 bit PWM output on timer 0
-  // to generate the output all we are doing is updating the output compare register A of timer0 to control its duty cycle
+  // The AVR backend does this by updating the output compare register A of timer0 to control its duty cycle
   // when we pass this through a simple RC filter it because and analogue audio signal.
   // Note that we are controlling the duty cycle - the time that it is on as opposed to off and we are not controlling
   // the frequency of the timer itself which stays constant.
@@ -162,41 +262,352 @@ void CIllutronB::OCR1A_ISR()
   // http://interface.khm.de/index.php/lab/experiments/arduino-dds-sinewave-generator/ 
   // TODO - get permission to include link
   
-  // TODO - need to add a means to control whether we split the channels or not.
+  // The mix can also be split across both of the timer 0 outputs, or panned between them - see setOutputMode. The mode
+  // is checked once here for the whole block so the loops that do the work never have to ask which mode they are in.
   // TODO - should also look at using just one timer, think its possible.
-  // update the timer duty cycle 
   
-  //Use this for two voices per channel (pins 5 and 6)
- // OCR0A=127+((m_Voices[0].getSample(bUpdateEnvelope,bApplyEnvelopePitchModulation) + m_Voices[1].getSample(bUpdateEnvelope,bApplyEnvelopePitchModulation))>>1);
- // OCR0B=127+((m_Voices[2].getSample(bUpdateEnvelope,bApplyEnvelopePitchModulation) + m_Voices[3].getSample(bUpdateEnvelope,bApplyEnvelopePitchModulation))>>1);
-  //Or this for four voices on single channel pin 6
-OCR0A=127+(((m_Voices[0].getSample(bUpdateEnvelope,bApplyEnvelopePitchModulation) + m_Voices[1].getSample(bUpdateEnvelope,bApplyEnvelopePitchModulation))
-+(m_Voices[2].getSample(bUpdateEnvelope,bApplyEnvelopePitchModulation) + m_Voices[3].getSample(bUpdateEnvelope,bApplyEnvelopePitchModulation)))>>2);
+  // Each voice adds its output for the whole block into nMix, the sum of four 8 bit voices needs 10 bits
+  // so we keep the sum at 16 bits and only scale it down to fit our 8 bit output once all the voices have been added.
+  // The result is exactly the same as adding the four voices sample by sample.
+  // A host build with more voices works the same way, CHANNEL_MAX voices need 8+CHANNEL_SHIFT bits which
+  // still fits in 16 bits for the 128 voices we allow.
+  // Split and pan need a second mix for output B, it only exists in those modes - on the AVR a block of RENDER_BLOCK_MAX
+  // samples is 128 bytes of stack for each mix and we only have 2048 bytes of RAM for everything.
+  int16_t nMix[RENDER_BLOCK_MAX];
+  for(uint8_t sIndex = 0;sIndex < sFrames;sIndex++)
+  {
+    nMix[sIndex] = 0;
+  }
+
+  // the envelope divider is shared by all of the voices, they all update thier envelopes on the same samples
+  uint8_t sEnvelopeDivider = m_sEnvelopeDivider;
+  switch(m_sOutputMode)
+  {
+    case OUTPUT_SPLIT:
+    {
+      // two voices per pin - the first half of the voices into nMix for output A, the rest into nMixB for output B
+      int16_t nMixB[RENDER_BLOCK_MAX];
+      for(uint8_t sIndex = 0;sIndex < sFrames;sIndex++)
+      {
+        nMixB[sIndex] = 0;
+      }
+      for(uint8_t sVoice = 0;sVoice < CHANNEL_MAX;sVoice++)
+      {
+        renderVoice(sVoice,(sVoice < SPLIT_VOICES) ? nMix : nMixB,NULL,sFrames,sEnvelopeDivider);
+      }
+      // half the voices on each pin so half the scaling, for four voices OCR0A=127+((voice0 + voice1)>>1) and
+      // OCR0B=127+((voice2 + voice3)>>1) - see IllutronB.h for SPLIT_CHANNEL_SHIFT
+      for(uint8_t sIndex = 0;sIndex < sFrames;sIndex++)
+      {
+        pOutA[sIndex] = nMix[sIndex]>>SPLIT_CHANNEL_SHIFT;
+      }
+      if(NULL != pOutB)
+      {
+        for(uint8_t sIndex = 0;sIndex < sFrames;sIndex++)
+        {
+          pOutB[sIndex] = nMixB[sIndex]>>SPLIT_CHANNEL_SHIFT;
+        }
+      }
+      break;
+    }
+    case OUTPUT_PAN:
+    {
+      // each voice adds itself to both sides as it renders, scaled by its pan - see renderVoice
+      int16_t nMixB[RENDER_BLOCK_MAX];
+      for(uint8_t sIndex = 0;sIndex < sFrames;sIndex++)
+      {
+        nMixB[sIndex] = 0;
+      }
+      for(uint8_t sVoice = 0;sVoice < CHANNEL_MAX;sVoice++)
+      {
+        renderVoice(sVoice,nMix,nMixB,sFrames,sEnvelopeDivider);
+      }
+      for(uint8_t sIndex = 0;sIndex < sFrames;sIndex++)
+      {
+        pOutA[sIndex] = nMix[sIndex]>>CHANNEL_SHIFT;
+      }
+      if(NULL != pOutB)
+      {
+        for(uint8_t sIndex = 0;sIndex < sFrames;sIndex++)
+        {
+          pOutB[sIndex] = nMixB[sIndex]>>CHANNEL_SHIFT;
+        }
+      }
+      break;
+    }
+    default:
+      // four voices on a single channel - CHANNEL_SHIFT is 2 for four voices, see IllutronB.h - and the same on both pins
+      for(uint8_t sVoice = 0;sVoice < CHANNEL_MAX;sVoice++)
+      {
+        renderVoice(sVoice,nMix,NULL,sFrames,sEnvelopeDivider);
+      }
+      for(uint8_t sIndex = 0;sIndex < sFrames;sIndex++)
+      {
+        pOutA[sIndex] = nMix[sIndex]>>CHANNEL_SHIFT;
+      }
+      if(NULL != pOutB)
+      {
+        for(uint8_t sIndex = 0;sIndex < sFrames;sIndex++)
+        {
+          pOutB[sIndex] = pOutA[sIndex];
+        }
+      }
+      break;
+  }
+
+  // let the sketch see the amplitude through getAmplitude, for visualisation
+  for(uint8_t sVoice = 0;sVoice < CHANNEL_MAX;sVoice++)
+  {
+    m_Voices[sVoice].m_sAmplitude = m_VoiceState.sAmplitude[sVoice];
+  }
+
+  // We update the envelope on every (ENVELOPE_DIVIDER+1)th sample, the divider counts down to 0, updates the envelope
+  // and starts again from ENVELOPE_DIVIDER. Work out where the count down has got to at the end of this block.
+  if(sFrames <= sEnvelopeDivider)
+  {
+    m_sEnvelopeDivider = sEnvelopeDivider - sFrames;
+  }
+  else
+  {
+    m_sEnvelopeDivider = ENVELOPE_DIVIDER - ((sFrames - sEnvelopeDivider - 1) % (ENVELOPE_DIVIDER+1));
+  }
   
-    
   // very simply counts down from a value set in setBPM and sets
   // a m_sBeatComplete when it reaches 0 before starting the count
   // again. m_sBeatComplete can be read from outside to 
   // determing if a beat is complete !
-  m_unBPMCounter--;
-  // is beat complete 
-  if(0 == m_unBPMCounter)
+  // A short beat can complete more than once in a block so we step from beat to beat
+  while(sFrames)
   {
+    uint16_t unBPMCounter = m_unBPMCounter;
+    // a counter of 0 rolls over and counts down from 65535 before it completes a beat
+    if((0 == unBPMCounter) || (unBPMCounter > sFrames))
+    {
+      m_unBPMCounter = unBPMCounter - sFrames;
+      break;
+    }
     // yes, restart counter, set m_sBeat true
+    sFrames -= unBPMCounter;
     m_unBPMCounter = m_unBPMCounterStart;
     m_sBeatComplete = true;
   }
 }
 
-// definitions of the CIllutronB static member variables - see the .h file for comments
-volatile unsigned int CIllutronB::m_unBPMCounterStart = 0;
-volatile unsigned int CIllutronB::m_unBPMCounter =0;                                   
-volatile unsigned char CIllutronB::m_sBeatComplete=0;
+// The sketch only ever changes the voices through m_Voices which send us commands, here we act on them.
+// Render calls this at the start of every block so a note triggered between two blocks starts on the first sample
+// of the next block, exactly as it did when the voices were read sample by sample.
+void CIllutronB::syncVoices()
+{
+  uint8_t sRead = m_sCommandRead;
+  uint8_t sWrite = ILLUTRONB_QUEUE_LOAD(m_sCommandWrite);
+  while(sRead != sWrite)
+  {
+    uint8_t sCommand = m_sCommands[sRead++ & (COMMAND_QUEUE_SIZE-1)];
+    uint8_t sVoice = m_sCommands[sRead++ & (COMMAND_QUEUE_SIZE-1)];
+    switch(sCommand)
+    {
+      case COMMAND_SETUP:
+        m_VoiceState.unWaveTableStart[sVoice] = m_VoiceState.unWaveLevelStart[sVoice] = getCommandAddress(sRead);
+        m_VoiceState.sMipmap[sVoice] = false;
+        m_VoiceState.sEnvelopeStage[sVoice] = ENVELOPE_TABLE;
+        m_VoiceState.unEnvelopeTableStart[sVoice] = getCommandAddress(sRead);
+        m_VoiceState.unEnvelopePhaseIncrement[sVoice] = getCommand(sRead);
+        m_VoiceState.unPitch[sVoice] = getCommand(sRead);
+        m_VoiceState.nEnvelopePitchModulation[sVoice] = getCommand(sRead);
+        break;
+      case COMMAND_TRIGGER_MIDI:
+      case COMMAND_TRIGGER_PITCH:
+        m_VoiceState.unPitch[sVoice] = getCommand(sRead);
+        startNote(sVoice);
+        break;
+      case COMMAND_INTERPOLATION:
+        m_VoiceState.sInterpolate[sVoice] = getCommand(sRead);
+        break;
+      case COMMAND_MIPMAP:
+        // the new setting is picked up when the next note starts
+        m_VoiceState.sMipmap[sVoice] = getCommand(sRead);
+        break;
+      case COMMAND_ADSR:
+        m_VoiceState.unAttackRate[sVoice] = getCommand(sRead);
+        m_VoiceState.unDecayRate[sVoice] = getCommand(sRead);
+        m_VoiceState.unSustainLevel[sVoice] = getCommand(sRead);
+        m_VoiceState.unReleaseRate[sVoice] = getCommand(sRead);
+        // silent until the next note
+        m_VoiceState.sEnvelopeStage[sVoice] = ENVELOPE_OFF;
+        m_VoiceState.unEnvelopeLevel[sVoice] = 0;
+        break;
+      case COMMAND_PAN:
+        m_VoiceState.sPan[sVoice] = getCommand(sRead);
+        break;
+      case COMMAND_OUTPUT_MODE:
+        m_sOutputMode = getCommand(sRead);
+        break;
+      case COMMAND_RELEASE:
+        if((ENVELOPE_TABLE != m_VoiceState.sEnvelopeStage[sVoice]) && (ENVELOPE_OFF != m_VoiceState.sEnvelopeStage[sVoice]))
+        {
+          m_VoiceState.sEnvelopeStage[sVoice] = ENVELOPE_RELEASE;
+        }
+        break;
+      default:
+        startNote(sVoice);
+        break;
+    }
+  }
+  // let the writer have the space back
+  ILLUTRONB_QUEUE_STORE(m_sCommandRead,sRead);
+}
+
+// the defaults are the same as they have always been, the voice is silent with the envelope already finished (0x8000)
+// so a voice with no wave table is never read until it is set up and triggered.
+// TODO - add a sensible default here or have the synth create a sensible default ?
+// or because we do not want to force inclusion of a specific set of wavetables and envelopes
+// put additional checks in the code to cope with a null wavetable and or envelope
+void CIllutronB::resetVoice(uint8_t sVoice)
+{
+  m_VoiceState.unWaveTableStart[sVoice] = 0;
+  m_VoiceState.unWaveLevelStart[sVoice] = 0;
+  m_VoiceState.unWavePhaseAccumulator[sVoice] = 0;
+  m_VoiceState.unWavePhaseIncrement[sVoice] = 1000;
+  m_VoiceState.unEnvelopeTableStart[sVoice] = 0;
+  m_VoiceState.unEnvelopePhaseAccumulator[sVoice] = 0x8000;
+  m_VoiceState.unEnvelopePhaseIncrement[sVoice] = 10;
+  m_VoiceState.sAmplitude[sVoice] = 0;
+  m_VoiceState.unPitch[sVoice] = 500;
+  m_VoiceState.nEnvelopePitchModulation[sVoice] = 0;
+  m_VoiceState.sInterpolate[sVoice] = 0;
+  m_VoiceState.sMipmap[sVoice] = false;
+  m_VoiceState.sEnvelopeStage[sVoice] = ENVELOPE_TABLE;
+  m_VoiceState.unEnvelopeLevel[sVoice] = 0;
+  m_VoiceState.unAttackRate[sVoice] = 0;
+  m_VoiceState.unDecayRate[sVoice] = 0;
+  m_VoiceState.unSustainLevel[sVoice] = 0;
+  m_VoiceState.unReleaseRate[sVoice] = 0;
+  m_VoiceState.sPan[sVoice] = 128;
+}
+
+// a note always starts at its own pitch, the pitch modulation bends it away as the envelope plays out
+void CIllutronB::startNote(uint8_t sVoice)
+{
+  uint16_t unPitch = m_VoiceState.unPitch[sVoice];
+  m_VoiceState.unEnvelopePhaseAccumulator[sVoice] = 0;
+  m_VoiceState.unWavePhaseIncrement[sVoice] = unPitch;
+
+  // an ADSR envelope attacks from wherever it is now, retriggering a note which is still sounding does not click
+  if(ENVELOPE_TABLE != m_VoiceState.sEnvelopeStage[sVoice])
+  {
+    m_VoiceState.sEnvelopeStage[sVoice] = ENVELOPE_ATTACK;
+  }
+
+  // Pick the mipmap level for this note. The wave plays at unWavePhaseIncrement/65536 cycles per sample and a harmonic
+  // aliases once it goes over half a cycle per sample, so a note can play 32768/unWavePhaseIncrement harmonics. Level n
+  // has 128>>n harmonics, so it is good for increments up to 256<<n. The pitch modulation can take the note higher than
+  // it starts - by the end of the note it has moved by (mod-512)/128 times the pitch, see modulatePitch - so we pick
+  // the level for the furthest the note will go.
+  if(m_VoiceState.sMipmap[sVoice])
+  {
+    int32_t lEndPitch = (int32_t)unPitch + (((int32_t)unPitch * (m_VoiceState.nEnvelopePitchModulation[sVoice] - 512)) >> 7);
+    uint32_t ulPeakPitch = (lEndPitch < 0) ? -lEndPitch : lEndPitch;
+    if(ulPeakPitch < unPitch)
+    {
+      ulPeakPitch = unPitch;
+    }
+    uint8_t sLevel = 0;
+    while((sLevel < (MIPMAP_LEVELS-1)) && (ulPeakPitch > (256UL << sLevel)))
+    {
+      sLevel++;
+    }
+    m_VoiceState.unWaveLevelStart[sVoice] = m_VoiceState.unWaveTableStart[sVoice] + (sLevel * 256);
+  }
+  else
+  {
+    m_VoiceState.unWaveLevelStart[sVoice] = m_VoiceState.unWaveTableStart[sVoice];
+  }
+}
+
+// Pitch modulation - the original Illutron bent the pitch of a note as it played with -
+//
+//   m_unWavePhaseIncrement=m_unPitch+(m_unPitch*(m_unEnvelopePhaseAccumulator/(32767.5*128.0  ))*((int)m_nEnvelopePitchModulation-512));
+//
+// which is far too much floating point maths for the Arduino, so it was commented out and the mod passed to setup did nothing.
+// Here is the same sum in integer maths. The envelope phase accumulator runs from 0 to 32767 as the note plays so
+// (unPitch*unEnvelopePhaseAccumulator)>>15 goes from 0 up to the pitch, we multiply that by the modulation depth - the mod
+// passed to setup less 512 - and divide by 128. A mod of 512 leaves the pitch alone, 300 drops it as the note decays like
+// the bass drum in the demo and 1000 raises it, at the end of the note the pitch has moved by (mod-512)/128 times itself.
+// On AVR this is a 16x16 bit multiply, a shift and a 16x16 bit signed multiply for each voice, and it only happens every
+// MODULATION_PITCH_DIVIDER samples so it adds well under a cycle per sample - see ILLUTRONB_PROFILE to measure it.
+void CIllutronB::modulatePitch()
+{
+  for(uint8_t sVoice = 0;sVoice < CHANNEL_MAX;sVoice++)
+  {
+    uint16_t unEnvelopePhaseAccumulator = m_VoiceState.unEnvelopePhaseAccumulator[sVoice];
+    // the envelope has finished and the voice is silent, leave it where it is until the next note
+    if(unEnvelopePhaseAccumulator & 0x8000)
+    {
+      continue;
+    }
+    uint16_t unPitch = m_VoiceState.unPitch[sVoice];
+    int16_t nDepth = m_VoiceState.nEnvelopePitchModulation[sVoice] - 512;
+    uint16_t unEnvelopePitch = ((uint32_t)unPitch * unEnvelopePhaseAccumulator) >> 15;
+    int32_t lBend = ((int32_t)unEnvelopePitch * nDepth) >> 7;
+    // a big enough drop takes the pitch through zero, it wraps around just as the floating point version did when it was
+    // stored in an unsigned int, and the wave plays backwards
+    m_VoiceState.unWavePhaseIncrement[sVoice] = unPitch + lBend;
+  }
+}
+
+// Start writing a command with sLength bytes of values, returns false if there is not room for it in the queue.
+// We never fill the queue completely, with a 256 byte queue a full queue would look the same as an empty one.
+bool CIllutronB::openCommand(uint8_t sCommand, uint8_t sVoice, uint8_t sLength)
+{
+  uint8_t sUsed = m_sCommandWrite - ILLUTRONB_QUEUE_LOAD(m_sCommandRead);
+  if((uint16_t)sUsed + 2 + sLength >= COMMAND_QUEUE_SIZE)
+  {
+    return false;
+  }
+  m_sCommandPut = m_sCommandWrite;
+  m_sCommands[m_sCommandPut++ & (COMMAND_QUEUE_SIZE-1)] = sCommand;
+  m_sCommands[m_sCommandPut++ & (COMMAND_QUEUE_SIZE-1)] = sVoice;
+  return true;
+}
 
-volatile unsigned char CIllutronB::m_sEnvelopeDivider=ENVELOPE_DIVIDER;             
-volatile unsigned int CIllutronB::m_unEnvelopePitchModulationDivider = MODULATION_PITCH_DIVIDER;
+// values are put a byte at a time, low byte first, so they can wrap around the end of the queue
+void CIllutronB::putCommand(uint16_t unValue)
+{
+  m_sCommands[m_sCommandPut++ & (COMMAND_QUEUE_SIZE-1)] = unValue;
+  m_sCommands[m_sCommandPut++ & (COMMAND_QUEUE_SIZE-1)] = unValue >> 8;
+}
 
-CIllutronB::CVoice CIllutronB::m_Voices[4];
+void CIllutronB::putCommandAddress(uintptr_t unAddress)
+{
+  for(uint8_t sByte = 0;sByte < sizeof(uintptr_t);sByte++)
+  {
+    m_sCommands[m_sCommandPut++ & (COMMAND_QUEUE_SIZE-1)] = unAddress;
+    unAddress >>= 8;
+  }
+}
+
+// hand the command over to render
+void CIllutronB::closeCommand()
+{
+  ILLUTRONB_QUEUE_STORE(m_sCommandWrite,m_sCommandPut);
+}
+
+uint16_t CIllutronB::getCommand(uint8_t &sRead)
+{
+  uint16_t unValue = m_sCommands[sRead++ & (COMMAND_QUEUE_SIZE-1)];
+  unValue |= (uint16_t)m_sCommands[sRead++ & (COMMAND_QUEUE_SIZE-1)] << 8;
+  return unValue;
+}
+
+uintptr_t CIllutronB::getCommandAddress(uint8_t &sRead)
+{
+  uintptr_t unAddress = 0;
+  for(uint8_t sByte = 0;sByte < sizeof(uintptr_t);sByte++)
+  {
+    unAddress |= (uintptr_t)m_sCommands[sRead++ & (COMMAND_QUEUE_SIZE-1)] << (8*sByte);
+  }
+  return unAddress;
+}
 
 //////////////////////////////////////////////////////
 // The CIllutronB::CVoice class
@@ -209,25 +620,12 @@ CIllutronB::CVoice CIllutronB::m_Voices[4];
 
 CIllutronB::CVoice::CVoice()
 {  
-  // record the voice configuration - see the .h file for details
-  
-  // TODO - add a sensible default here or have the synth create a sensible default ?
-  // or because we do not want to force inclusion of a specific set of wavetables and envelopes
-  // put additional checks in the code to cope with a null wavetable and or envelope 
-  
-  // the same comment really applies to all default values below - 
-  m_unEnvelopeTableStart = NULL;
-  m_unEnvelopePhaseAccumulator = 0x8000;
-  m_unEnvelopePhaseIncrement = 10;
-  m_sAmplitude = 255;
-  
-  m_nEnvelopePitchModulation = 0;
-  
-  m_unWaveTableStart = NULL;
-  m_unWavePhaseAccumulator = 0;
-  m_unWavePhaseIncrement = 1000;
-  
-  m_unPitch = 500;
+  // the voice configuration is kept by the synth - see CIllutronB::resetVoice for the defaults. The synth tells
+  // each of its voices which synth and voice they are when it is created.
+  m_pSynth = NULL;
+  m_sVoice = 0;
+
+  m_sAmplitude = 0;
 }
 
 // This function could equally have been called decay - everytime its call it moves to the next point in the envelope table
@@ -247,48 +645,283 @@ CIllutronB::CVoice::CVoice()
 // stopping the note.
 // For the wave tables we do not follow this approach because it does not matter if they rollover and start again from zero, in fact we want them to.
 // void CIllutronB::CVoice::applyEnvelopeToAmplitude()
-// NOTE - this is now moved into the if(bUpdateEnvelope) section of get sample
-signed char CIllutronB::CVoice::getSample(uint8_t bUpdateEnvelope,uint8_t bApplyEnvelopePitchModulation)
+// NOTE - this is now moved into the envelope update section of render
+//
+#if defined(ILLUTRONB_SIMD)
+// Host only - add the wave values in pWave scaled by the amplitudes in pAmplitude into pMix.
+// This is the same sum as the plain C++ version in renderVoice - an 8 bit signed wave value times an 8 bit amplitude
+// always fits in 16 bits, so a 16 bit multiply and shift gives exactly the same answer as the C++ maths does in int.
+static void mixVoice(int16_t *pMix, const int16_t *pWave, const int16_t *pAmplitude, uint8_t sFrames)
+{
+  uint8_t sIndex = 0;
+#if defined(__AVX2__)
+  for(;sIndex + 16 <= sFrames;sIndex += 16)
+  {
+    __m256i product = _mm256_mullo_epi16(_mm256_loadu_si256((const __m256i*)&pWave[sIndex]),_mm256_loadu_si256((const __m256i*)&pAmplitude[sIndex]));
+    __m256i mix = _mm256_add_epi16(_mm256_loadu_si256((const __m256i*)&pMix[sIndex]),_mm256_srai_epi16(product,8));
+    _mm256_storeu_si256((__m256i*)&pMix[sIndex],mix);
+  }
+#endif
+#if defined(__SSE2__)
+  for(;sIndex + 8 <= sFrames;sIndex += 8)
+  {
+    __m128i product = _mm_mullo_epi16(_mm_loadu_si128((const __m128i*)&pWave[sIndex]),_mm_loadu_si128((const __m128i*)&pAmplitude[sIndex]));
+    __m128i mix = _mm_add_epi16(_mm_loadu_si128((const __m128i*)&pMix[sIndex]),_mm_srai_epi16(product,8));
+    _mm_storeu_si128((__m128i*)&pMix[sIndex],mix);
+  }
+#elif defined(__ARM_NEON)
+  for(;sIndex + 8 <= sFrames;sIndex += 8)
+  {
+    int16x8_t product = vmulq_s16(vld1q_s16(&pWave[sIndex]),vld1q_s16(&pAmplitude[sIndex]));
+    vst1q_s16(&pMix[sIndex],vaddq_s16(vld1q_s16(&pMix[sIndex]),vshrq_n_s16(product,8)));
+  }
+#endif
+  // whatever is left over at the end of the block
+  for(;sIndex < sFrames;sIndex++)
+  {
+    pMix[sIndex] += (pWave[sIndex]*pAmplitude[sIndex])>>8;
+  }
+}
+#endif
+
+// Linear interpolation - the top 8 bits of the wave phase accumulator pick the wave table entry and the bottom 8 bits say
+// how far we are towards the next one, we add that fraction of the step between the two entries.
+// The step between two signed 8 bit entries needs 9 bits, we halve it so that the multiply is 8 bit by 8 bit - a single
+// mulsu instruction on the AVR - and shift by 7 instead of 8 to make up for it. Halving towards zero rather than down
+// keeps the result between the two entries so it always fits in 8 bits, it is never more than 1 away from the exact blend.
+// The tables are 256 entries long, the entry after the last one is the first one.
+//
+// On the AVR this is one more pgm_read_byte, a subtract, a halving, the multiply and an add for each sample - about
+// 20 cycles. Out of the 2000 cycles we have for each sample that is 1% of the budget for each interpolated voice.
+static inline int16_t getInterpolatedWave(uintptr_t unWaveTableStart, uint16_t unWavePhaseAccumulator)
 {
-  // calculate the amplitude based on the position within the enveloped
-  if(bUpdateEnvelope)
+  uint8_t sEntry = unWavePhaseAccumulator >> 8;
+  int16_t nWave = (signed char)pgm_read_byte(unWaveTableStart + sEntry);
+  int16_t nNextWave = (signed char)pgm_read_byte(unWaveTableStart + (uint8_t)(sEntry + 1));
+  int8_t sHalfStep = (nNextWave - nWave) / 2;
+  return nWave + ((sHalfStep * (uint8_t)unWavePhaseAccumulator) >> 7);
+}
+
+// renderVoice works through a block of samples for one voice and adds them into pMix, the envelope is updated at the start
+// of every (ENVELOPE_DIVIDER+1)th sample counting from sEnvelopeDivider. Between envelope updates the amplitude is fixed
+// which gives us runs of samples that are all calculated in the same way.
+// With a pMixB as well the voice is panned - each sample is added to pMix scaled by the gain for output A and to pMixB
+// scaled by the gain for output B, so the voice never needs a mix of its own.
+void CIllutronB::renderVoice(uint8_t sVoice, int16_t *pMix, int16_t *pMixB, uint8_t sFrames, uint8_t sEnvelopeDivider)
+{
+  // take copies of the voice state, the compiler can then keep them in registers for the whole block
+  // rather than reading and writing memory for every sample. We write the ones that change back at the end.
+  uint16_t unWavePhaseAccumulator = m_VoiceState.unWavePhaseAccumulator[sVoice];
+  uint16_t unWavePhaseIncrement = m_VoiceState.unWavePhaseIncrement[sVoice];
+  uintptr_t unWaveTableStart = m_VoiceState.unWaveLevelStart[sVoice];
+  uint16_t unEnvelopePhaseAccumulator = m_VoiceState.unEnvelopePhaseAccumulator[sVoice];
+  uint16_t unEnvelopePhaseIncrement = m_VoiceState.unEnvelopePhaseIncrement[sVoice];
+  uintptr_t unEnvelopeTableStart = m_VoiceState.unEnvelopeTableStart[sVoice];
+  unsigned char sAmplitude = m_VoiceState.sAmplitude[sVoice];
+  uint8_t sInterpolate = m_VoiceState.sInterpolate[sVoice];
+  uint8_t sEnvelopeStage = m_VoiceState.sEnvelopeStage[sVoice];
+  uint16_t unEnvelopeLevel = m_VoiceState.unEnvelopeLevel[sVoice];
+
+  // The pan is the gain for B out of 256 and A gets whatever B does not, so 128 is exactly in the middle and each step
+  // either side moves one 256th from one output to the other - 127 and 129 are mirror images. 255 is taken as 256 so
+  // that it is all the way over, just as 0 is all the way over to A. One voice is only ever 8 bits (-128 to 126) so
+  // times a gain of up to 256 it still fits in 16 bits.
+  uint8_t sPan = m_VoiceState.sPan[sVoice];
+  int16_t nGainB = (255 == sPan) ? 256 : sPan;
+  int16_t nGainA = 256 - nGainB;
+
+#if defined(ILLUTRONB_SIMD)
+  // on a PC we look up the wave and the amplitude for each sample here and then mix the whole block in one go with
+  // vector instructions, the table look ups cannot be done with vector instructions but the rest of the maths can.
+  // sFilled is how far we have filled them, silent runs are only filled in if there is a sounding run after them.
+  int16_t nWave[RENDER_BLOCK_MAX];
+  int16_t nAmplitude[RENDER_BLOCK_MAX];
+  uint8_t sFilled = 0;
+#endif
+
+  uint8_t sIndex = 0;
+  uint8_t sEnvelopeUpdate = sEnvelopeDivider; // the next sample which updates the envelope
+  while(sIndex < sFrames)
   {
-    if(!(m_unEnvelopePhaseAccumulator&0x8000))
+    // calculate the amplitude based on the position within the enveloped
+    if(sIndex == sEnvelopeUpdate)
     {
-      // amplitude = envelope position determined by adding envelope increment to envelope accumulator
-      m_sAmplitude=pgm_read_byte(m_unEnvelopeTableStart + ((m_unEnvelopePhaseAccumulator+=m_unEnvelopePhaseIncrement)>>7) );
-        
-      if(m_unEnvelopePhaseAccumulator&0x8000)
+      if(ENVELOPE_TABLE != sEnvelopeStage)
       {
-        m_sAmplitude=0;
+        // An ADSR envelope - each stage is a straight line so all it takes is an add or a subtract and a compare.
+        // The envelope phase accumulator still counts through the length of the note for the pitch modulation.
+        if(!(unEnvelopePhaseAccumulator&0x8000))
+        {
+          unEnvelopePhaseAccumulator+=unEnvelopePhaseIncrement;
+        }
+        switch(sEnvelopeStage)
+        {
+          case ENVELOPE_ATTACK:
+          {
+            uint16_t unAttackRate = m_VoiceState.unAttackRate[sVoice];
+            if(unEnvelopeLevel >= (0xFFFF - unAttackRate))
+            {
+              unEnvelopeLevel = 0xFFFF;
+              sEnvelopeStage = ENVELOPE_DECAY;
+            }
+            else
+            {
+              unEnvelopeLevel += unAttackRate;
+            }
+            break;
+          }
+          case ENVELOPE_DECAY:
+          {
+            // the attack always finishes at full volume so the level is never below the sustain level here
+            uint16_t unSustainLevel = m_VoiceState.unSustainLevel[sVoice];
+            if((uint16_t)(unEnvelopeLevel - unSustainLevel) <= m_VoiceState.unDecayRate[sVoice])
+            {
+              unEnvelopeLevel = unSustainLevel;
+              sEnvelopeStage = (0 == unSustainLevel) ? ENVELOPE_OFF : ENVELOPE_SUSTAIN;
+            }
+            else
+            {
+              unEnvelopeLevel -= m_VoiceState.unDecayRate[sVoice];
+            }
+            break;
+          }
+          case ENVELOPE_RELEASE:
+          {
+            uint16_t unReleaseRate = m_VoiceState.unReleaseRate[sVoice];
+            if(unEnvelopeLevel <= unReleaseRate)
+            {
+              unEnvelopeLevel = 0;
+              sEnvelopeStage = ENVELOPE_OFF;
+            }
+            else
+            {
+              unEnvelopeLevel -= unReleaseRate;
+            }
+            break;
+          }
+          default:
+            // sustain holds where it is and off stays at 0
+            break;
+        }
+        sAmplitude = unEnvelopeLevel >> 8;
       }
+      else if(!(unEnvelopePhaseAccumulator&0x8000))
+      {
+        // amplitude = envelope position determined by adding envelope increment to envelope accumulator
+        // test for the end of the table before reading, the byte after the end of the table is not ours to read
+        // (on AVR it happens to be the next table in flash, but we would throw it away anyway)
+        unEnvelopePhaseAccumulator+=unEnvelopePhaseIncrement;
+        if(unEnvelopePhaseAccumulator&0x8000)
+        {
+          sAmplitude=0;
+        }
+        else
+        {
+          sAmplitude=pgm_read_byte(unEnvelopeTableStart + (unEnvelopePhaseAccumulator>>7));
+        }
+      }
+      else
+      {
+        sAmplitude=0;
+      }
+      sEnvelopeUpdate += (ENVELOPE_DIVIDER+1);
+    }
+
+    // Pitch modulation used to be applied here, it is now done for all of the voices every MODULATION_PITCH_DIVIDER
+    // samples by modulatePitch so the wave phase increment is fixed for the whole block
+
+    // the run of samples up to the next envelope update or the end of the block
+    uint8_t sRunEnd = (sEnvelopeUpdate < sFrames) ? sEnvelopeUpdate : sFrames;
+    
+    // if the amplitude is 0, the sample will always be 0 so there is no need to waste time calculating it.
+    // we still need to keep the wave moving so that it is in the right place when the amplitude comes back.
+    if(sAmplitude == 0)
+    {
+      unWavePhaseAccumulator += unWavePhaseIncrement * (uint16_t)(sRunEnd - sIndex);
+      sIndex = sRunEnd;
     }
     else
     {
-      m_sAmplitude=0;
+#if defined(ILLUTRONB_SIMD)
+      for(;sFilled < sIndex;sFilled++)
+      {
+        nWave[sFilled] = 0;
+        nAmplitude[sFilled] = 0;
+      }
+      // an interpolated voice renders the whole run here and skips the loop below
+      if(sInterpolate)
+      {
+        for(;sIndex < sRunEnd;sIndex++)
+        {
+          unWavePhaseAccumulator+=unWavePhaseIncrement;
+          nWave[sIndex] = getInterpolatedWave(unWaveTableStart,unWavePhaseAccumulator);
+          nAmplitude[sIndex] = sAmplitude;
+        }
+      }
+      for(;sIndex < sRunEnd;sIndex++)
+      {
+        unWavePhaseAccumulator+=unWavePhaseIncrement;
+        nWave[sIndex] = (signed char)pgm_read_byte(unWaveTableStart+((unWavePhaseAccumulator)>>8));
+        nAmplitude[sIndex] = sAmplitude;
+      }
+      sFilled = sRunEnd;
+#else
+      if(NULL != pMixB)
+      {
+        // panned - the same sample as below, added to both sides
+        while(sIndex < sRunEnd)
+        {
+          unWavePhaseAccumulator+=unWavePhaseIncrement;
+          int16_t nSample = sInterpolate ? getInterpolatedWave(unWaveTableStart,unWavePhaseAccumulator) :
+                                           (signed char)pgm_read_byte(unWaveTableStart+((unWavePhaseAccumulator)>>8));
+          nSample = (nSample*sAmplitude)>>8;
+          pMix[sIndex] += (int16_t)(nSample*nGainA)>>8;
+          pMixB[sIndex++] += (int16_t)(nSample*nGainB)>>8;
+        }
+      }
+      // an interpolated voice renders the whole run here and skips the loop below
+      if(sInterpolate)
+      {
+        while(sIndex < sRunEnd)
+        {
+          unWavePhaseAccumulator+=unWavePhaseIncrement;
+          pMix[sIndex++] += ((getInterpolatedWave(unWaveTableStart,unWavePhaseAccumulator)*sAmplitude)>>8);
+        }
+      }
+      while(sIndex < sRunEnd)
+      {
+        unWavePhaseAccumulator+=unWavePhaseIncrement;
+        
+        // read a byte representing the current point in the waveform from program memory, multiply it by the current amplitude
+        // to mix the waveform with the envelope - its so simple, but this is what makes the rich range of sound from a wavetable synth possible
+        pMix[sIndex++] += (((signed char)pgm_read_byte(unWaveTableStart+((unWavePhaseAccumulator)>>8))*sAmplitude)>>8);
+      }
+#endif
     }
   }
-  
-  if(bApplyEnvelopePitchModulation)
+
+#if defined(ILLUTRONB_SIMD)
+  // anything after the last sounding run is silent and adds nothing to the mix
+  if(sFilled && (NULL != pMixB))
   {
-    // this works
-    // m_unWavePhaseIncrement=m_unPitch+(m_unPitch*(m_unEnvelopePhaseAccumulator/(32767.5*128.0  ))*((int)m_nEnvelopePitchModulation-512));
-    // this probably doesn't, as and when we understand the objective of m_nEnvelopePitchModulation we will rework for integer maths.
-    // m_unWavePhaseIncrement=m_unPitch+(m_unPitch*(m_unEnvelopePhaseAccumulator/(32767*128))*((int)m_nEnvelopePitchModulation-512));
+    for(uint8_t sIndex = 0;sIndex < sFilled;sIndex++)
+    {
+      int16_t nSample = (nWave[sIndex]*nAmplitude[sIndex])>>8;
+      pMix[sIndex] += (int16_t)(nSample*nGainA)>>8;
+      pMixB[sIndex] += (int16_t)(nSample*nGainB)>>8;
+    }
   }
-  
-  m_unWavePhaseAccumulator+=m_unWavePhaseIncrement;
-  
-  // if the amplitude is 0, the sample will always be 0 so there is no need to waste time calculating it.
-  if(m_sAmplitude == 0)
+  else if(sFilled)
   {
-    return 0;
+    mixVoice(pMix,nWave,nAmplitude,sFilled);
   }
+#endif
 
-  // read a byte representing the current point in the waveform from program memory, multiply it by the current amplitude
-  // to mix the waveform with the envelope - its so simple, but this is what makes the rich range of sound from a wavetable synth possible
- 
-  return (((signed char)pgm_read_byte(m_unWaveTableStart+((m_unWavePhaseAccumulator)>>8))*m_sAmplitude)>>8);
+  m_VoiceState.unWavePhaseAccumulator[sVoice] = unWavePhaseAccumulator;
+  m_VoiceState.unEnvelopePhaseAccumulator[sVoice] = unEnvelopePhaseAccumulator;
+  m_VoiceState.sAmplitude[sVoice] = sAmplitude;
+  m_VoiceState.sEnvelopeStage[sVoice] = sEnvelopeStage;
+  m_VoiceState.unEnvelopeLevel[sVoice] = unEnvelopeLevel;
 }
 
 unsigned char CIllutronB::CVoice::getAmplitude()
@@ -296,29 +929,46 @@ unsigned char CIllutronB::CVoice::getAmplitude()
   return m_sAmplitude;
 }
 
+#if !defined(ILLUTRONB_NO_FLOAT)
 // Set the characteristics or a voice - waveform table , pitch, envelope table, length of the note, and the pitch modulation
 // TODO - at present the length of a note is not changed by changing the BPM - undecided as to whether it should be.
-void CIllutronB::CVoice::setup(unsigned int waveform, float pitch, unsigned int envelope, float length, unsigned int mod)
+// This is float maths, to set a voice up while the sketch plays use a preset - see SVoicePreset.
+bool CIllutronB::CVoice::setup(uintptr_t waveform, float pitch, uintptr_t envelope, float length, unsigned int mod)
 {
-  // do the maths before we turn off interrupts
   unsigned int tempEnvelopePhaseIncrement = (1.0/length)/(SAMPLE_RATE/(32767.5*10.0));//[s];
   pitch = pitch/(SAMPLE_RATE/TIMER1_MAX); //[Hz] // based for pitch adjustment - transpose ?
   
-  // turn off interrupts and copy the calculated values into the voice
-  unsigned char sreg = SREG;
-  cli();
-  
-  m_unWaveTableStart=waveform;//[address in program memory]
-  m_unEnvelopeTableStart=envelope;//[address in program memory]
-  m_unEnvelopePhaseIncrement = tempEnvelopePhaseIncrement;
-  m_unPitch = pitch;
-  m_nEnvelopePitchModulation=mod;//0-1023 512=no mod
-  
-  SREG = sreg;
+  return sendSetup(waveform,envelope,tempEnvelopePhaseIncrement,pitch,mod);
+}
+#endif
+
+// A preset has the numbers setup would have worked out already, so all we do is copy them out of flash
+bool CIllutronB::CVoice::setPreset(const SVoicePreset *pPreset)
+{
+  SVoicePreset preset;
+  memcpy_P(&preset,pPreset,sizeof(SVoicePreset));
+  return sendSetup((uintptr_t)preset.pWaveTable,(uintptr_t)preset.pEnvelope,preset.unEnvelopePhaseIncrement,preset.unPitch,preset.unMod);
+}
+
+// send the calculated values to render, they all arrive together at the start of the next block - render never sees
+// half of an old setup and half of a new one
+bool CIllutronB::CVoice::sendSetup(uintptr_t waveform, uintptr_t envelope, uint16_t unEnvelopePhaseIncrement, uint16_t unPitch, uint16_t unMod)
+{
+  if(m_pSynth->openCommand(COMMAND_SETUP,m_sVoice,2*sizeof(uintptr_t)+6))
+  {
+    m_pSynth->putCommandAddress(waveform);//[address in program memory]
+    m_pSynth->putCommandAddress(envelope);//[address in program memory]
+    m_pSynth->putCommand(unEnvelopePhaseIncrement);
+    m_pSynth->putCommand(unPitch);
+    m_pSynth->putCommand(unMod);//0-1023 512=no mod
+    m_pSynth->closeCommand();
+    return true;
+  }
+  return false;
 }
 
 // Play a note in the supplied midi note number using the current voice configuration
-void CIllutronB::CVoice::triggerMidi(unsigned char note)
+bool CIllutronB::CVoice::triggerMidi(unsigned char note)
 {
 //  PITCH[voice]=(440. * exp(.057762265 * (note - 69.)))/(FS/65535.0); //[MIDI note]
 
@@ -340,45 +990,160 @@ void CIllutronB::CVoice::triggerMidi(unsigned char note)
   
   // lets do this first - its a lot of maths
 //  m_unPitch = PITCHS[note];// getFrequencyFromMidiNoteNumber(note);
-  unsigned char sreg = SREG;
-  cli();
-  m_unPitch=PITCHS[note];
-  m_unEnvelopePhaseAccumulator=0;
-  m_unWavePhaseIncrement=m_unPitch;
-  SREG = sreg;
+  // Update - its now a look up table in program memory, see getMidiPitch.
+  // The pitch becomes the wave phase increment and the envelope starts again at the next block - see syncVoices
+  if(m_pSynth->openCommand(COMMAND_TRIGGER_MIDI,m_sVoice,2))
+  {
+    m_pSynth->putCommand(getMidiPitch(note));
+    m_pSynth->closeCommand();
+    return true;
+  }
+  return false;
 }
 
-// refer to the comments regarding PITCHS - this is not currently used
-// ideally a table of midi note to frequency mappings should be pre calculated and included with the library as progmem
+// The frequencies of the top octave of midi notes, 120 to 131, times 65536 - 440*2^((note-69)/12)*65536 rounded.
+// Each octave down is half the frequency so every other note is one of these shifted right by 16 plus the number of
+// octaves it is below the top one, the fraction bits take care of the rounding on the way down.
+static const uint32_t MidiTopOctave[12] PROGMEM =
+{
+  548668578UL,581294109UL,615859655UL,652480576UL,691279090UL,732384684UL,
+  775934544UL,822074013UL,870957077UL,922746880UL,977616265UL,1035748353UL
+};
+
+// refer to the comments regarding MidiPitchTable - this is not currently used
+// Based on information provided here - http://www.phys.unsw.edu.au/jw/notes.html
+// It used to be pow(2,(note-69)/12)*440 in float, which the AVR takes thousands of cycles over. Now it is an 8 bit divide
+// by 12, a 4 byte read from flash and a shift of 16 to 26 bits - about 150 cycles for any note - and comes out exactly
+// the same as the float version for all 128 notes, the host tools check that (see IllutronB_render.cpp). Notes above
+// 127 wrap round like getMidiPitch does.
 unsigned int CIllutronB::CVoice::getFrequencyFromMidiNoteNumber(unsigned char note)
 {
-  // Based on information provided here - http://www.phys.unsw.edu.au/jw/notes.html
-  // as this is a function we can change it to use a look up table without effecting the rest of the code.
-  // the best option might be to put a precalculated lookup table into progmem - should do this, its a good option.
-  
-  return pow(2,((float)note-69.0)/12.0)*440;
+  note &= 0x7F;
+  uint8_t sOctave = note/12;
+  return pgm_read_dword(&MidiTopOctave[note - (sOctave*12)]) >> (16 + 10 - sOctave);
 }
 
 // play the most recently played note on this voice using the last pitch played and all other configuration unchanged
 // its good for repetition like percussion and drums.
-void CIllutronB::CVoice::trigger()
+bool CIllutronB::CVoice::trigger()
 {
-  m_unEnvelopePhaseAccumulator=0;
+  if(m_pSynth->openCommand(COMMAND_TRIGGER,m_sVoice,0))
+  {
+    m_pSynth->closeCommand();
+    return true;
+  }
+  return false;
 }
 
 // trigger using a pitch defined in the pitches.h file supplied with Arduino IDE in the tone examples.
-void CIllutronB::CVoice::triggerPitch(uint16_t sPitch)
-{
-  // do the maths before we block interrupts, this will prevent any glitches that would happen if
-  // a lot of work has to be done while interrupts are blocked
-  unsigned int tempWavePhaseIncrement = UPDATE_RATE/(sPitch*256.0);
-  // now lets turn off interrupts and copy our new value
-  // not interrupts = no glitches that would happen from the ISR reading part of the old value and part of the new value.
-  uint8_t sreg = SREG;
-  cli();
-  m_unWavePhaseIncrement = tempWavePhaseIncrement;
-  m_unEnvelopePhaseAccumulator = 0;
-  SREG = sreg;
+// This was UPDATE_RATE/(sPitch*256.0) in float, the same sum in integers is a 16 bit divide - around 200 cycles on the
+// AVR rather than a float multiply, divide and conversion. Anything from 32 up came out as 0 and so does this, without
+// the divide, and so does 0 rather than dividing by zero.
+bool CIllutronB::CVoice::triggerPitch(uint16_t sPitch)
+{
+  uint16_t tempWavePhaseIncrement = ((0 == sPitch) || (sPitch >= 32)) ? 0 : (uint16_t)UPDATE_RATE/(uint16_t)(sPitch << 8);
+  // render never sees part of the old value and part of the new value, the command is only handed over once it is complete
+  if(m_pSynth->openCommand(COMMAND_TRIGGER_PITCH,m_sVoice,2))
+  {
+    m_pSynth->putCommand(tempWavePhaseIncrement);
+    m_pSynth->closeCommand();
+    return true;
+  }
+  return false;
+}
+
+// blend between wave table entries from the next block on, see getInterpolatedWave
+bool CIllutronB::CVoice::setInterpolation(bool bInterpolate)
+{
+  if(m_pSynth->openCommand(COMMAND_INTERPOLATION,m_sVoice,2))
+  {
+    m_pSynth->putCommand(bInterpolate);
+    m_pSynth->closeCommand();
+    return true;
+  }
+  return false;
+}
+
+// pick the mipmap level as each note starts from the next note on, see startNote
+bool CIllutronB::CVoice::setMipmap(bool bMipmap)
+{
+  if(m_pSynth->openCommand(COMMAND_MIPMAP,m_sVoice,2))
+  {
+    m_pSynth->putCommand(bMipmap);
+    m_pSynth->closeCommand();
+    return true;
+  }
+  return false;
+}
+
+// The stages are updated UPDATE_RATE/(ENVELOPE_DIVIDER+1) times a second, each time a stage moves the level by its rate.
+// A full sweep is 65535 so the rate for a stage lasting t seconds is 65535/(t*updates per second), never less than 1
+// and anything shorter than one update happens in one update. ADSR_RATE in IllutronB.h is the same sum for constants.
+#if !defined(ILLUTRONB_NO_FLOAT)
+static uint16_t getEnvelopeRate(float seconds)
+{
+  float rate = 65535.0/(seconds*(UPDATE_RATE/(ENVELOPE_DIVIDER+1)));
+  if(!(rate < 65535.0))
+  {
+    return 65535;
+  }
+  return (rate < 1.0) ? 1 : rate;
+}
+
+bool CIllutronB::CVoice::setADSR(float attack, float decay, unsigned char sustain, float release)
+{
+  return setADSRRates(getEnvelopeRate(attack),getEnvelopeRate(decay),sustain,getEnvelopeRate(release));
+}
+#endif
+
+// switch the voice over to its own ADSR envelope with the rates already worked out
+bool CIllutronB::CVoice::setADSRRates(uint16_t unAttack, uint16_t unDecay, unsigned char sustain, uint16_t unRelease)
+{
+  if(m_pSynth->openCommand(COMMAND_ADSR,m_sVoice,8))
+  {
+    m_pSynth->putCommand(unAttack);
+    m_pSynth->putCommand(unDecay);
+    m_pSynth->putCommand(sustain << 8);
+    m_pSynth->putCommand(unRelease);
+    m_pSynth->closeCommand();
+    return true;
+  }
+  return false;
+}
+
+// where the voice sits between the two outputs in OUTPUT_PAN mode
+bool CIllutronB::CVoice::setPan(uint8_t sPan)
+{
+  if(m_pSynth->openCommand(COMMAND_PAN,m_sVoice,2))
+  {
+    m_pSynth->putCommand(sPan);
+    m_pSynth->closeCommand();
+    return true;
+  }
+  return false;
+}
+
+// the voice byte is not used, any voice would do
+bool CIllutronB::setOutputMode(uint8_t sMode)
+{
+  if(openCommand(COMMAND_OUTPUT_MODE,0,2))
+  {
+    putCommand(sMode);
+    closeCommand();
+    return true;
+  }
+  return false;
+}
+
+// start the release stage of an ADSR envelope
+bool CIllutronB::CVoice::release()
+{
+  if(m_pSynth->openCommand(COMMAND_RELEASE,m_sVoice,0))
+  {
+    m_pSynth->closeCommand();
+    return true;
+  }
+  return false;
 }
 
 // TODO - these and other functions can be added to the library once it is clear who is using it and how.
@@ -25,23 +25,146 @@
 // 5) Providing a tempo - the user can update the Beats per minute at any time by calling - setBPM - the pitch will not change, just the speed
 //
 // Note that a squencer is not currently provided within CIllutronB - it would be a logical development to provide an additional sequencer class
-// It would also be logical to provide a class for storing and retreiving voices. But lets get creating first.
+// Voices can be stored in flash and set up in one go as presets - see SVoicePreset and Presets.h.
 //
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-#include <arduino.h>
+// The render core (IllutronB.cpp) is plain C++ and does not touch any AVR hardware registers, the thin AVR backend
+// in IllutronB_avr.cpp owns the timers and the interrupt. This lets the exact same integer arithmetic be compiled
+// and run on a PC for profiling and testing. When we are not building for AVR we provide stand ins for the
+// few avr-libc helpers used by the core - on a PC 'program memory' is just normal memory.
+#if defined(__AVR__)
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+
+// used by the backend to copy multi byte values shared with the ISR without the ISR seeing half old, half new values
+#define ILLUTRONB_ATOMIC_BEGIN() uint8_t sreg = SREG; cli()
+#define ILLUTRONB_ATOMIC_END() SREG = sreg
+
+// read and write the single byte positions of the command queue - see CIllutronB::openCommand. A byte is read or written
+// in one instruction so whoever is on the other side of the queue never sees half of it, the positions and the queue
+// itself are volatile so the compiler keeps the reads and writes in the order we wrote them.
+#define ILLUTRONB_QUEUE_LOAD(position) (position)
+#define ILLUTRONB_QUEUE_STORE(position,value) (position) = (value)
+#else
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define PROGMEM
+#define pgm_read_byte(address) (*(const uint8_t*)(address))
+#define pgm_read_word(address) (*(const uint16_t*)(address))
+#define pgm_read_dword(address) (*(const uint32_t*)(address))
+#define memcpy_P(dest,src,size) memcpy((dest),(src),(size))
+
+// there is no interrupt on the host, the render core is called directly
+#define ILLUTRONB_ATOMIC_BEGIN()
+#define ILLUTRONB_ATOMIC_END()
+
+// a host build might render from an audio thread while another thread sets up, triggers and queues notes for the voices,
+// a PC can reorder memory accesses between threads so here the positions of the command queue and of the queued notes
+// (see queueTrigger) need acquire and release ordering. Both queues have one writer and one reader, only one thread
+// should set up and trigger the voices.
+#define ILLUTRONB_QUEUE_LOAD(position) __atomic_load_n(&(position),__ATOMIC_ACQUIRE)
+#define ILLUTRONB_QUEUE_STORE(position,value) __atomic_store_n(&(position),(value),__ATOMIC_RELEASE)
+#endif
 
 // Do not change any of the following defines - if you can think of something you would like to try by doing so, dont.
 // Request the function instead and we will find a sustainable way of adding it.
 
+// The one exception - CHANNEL_MAX is the number of voices. The Arduino has time for four, which is what the demo sketch
+// and sequences are written for, but a host build can have more by compiling with -DCHANNEL_MAX=16 for example.
+// The voices are mixed by adding them together and scaling the sum back to 8 bits with a shift of CHANNEL_SHIFT
+// which is worked out here, so the shift is a constant and costs the same as the fixed >>2 we used to have for four voices.
+// If CHANNEL_MAX is not a power of two we round the shift up so that the mix can never overflow our 8 bit output.
+#ifndef CHANNEL_MAX
 #define CHANNEL_MAX 4
+#endif
+
+#if CHANNEL_MAX < 1
+#error CHANNEL_MAX must be at least 1
+#elif CHANNEL_MAX == 1
+#define CHANNEL_SHIFT 0
+#elif CHANNEL_MAX <= 2
+#define CHANNEL_SHIFT 1
+#elif CHANNEL_MAX <= 4
+#define CHANNEL_SHIFT 2
+#elif CHANNEL_MAX <= 8
+#define CHANNEL_SHIFT 3
+#elif CHANNEL_MAX <= 16
+#define CHANNEL_SHIFT 4
+#elif CHANNEL_MAX <= 32
+#define CHANNEL_SHIFT 5
+#elif CHANNEL_MAX <= 64
+#define CHANNEL_SHIFT 6
+#elif CHANNEL_MAX <= 128
+#define CHANNEL_SHIFT 7
+#else
+#error CHANNEL_MAX can be at most 128 - the voices are counted in 8 bits and mixed in 16 bits
+#endif
+
+// With the output split across two pins each pin has half of the voices - the first SPLIT_VOICES on pin 6 and the rest
+// on pin 5 - so it needs one bit less of shift, which keeps one more bit of each voice. See CIllutronB::setOutputMode.
+#define SPLIT_VOICES ((CHANNEL_MAX+1)/2)
+#if CHANNEL_SHIFT > 0
+#define SPLIT_CHANNEL_SHIFT (CHANNEL_SHIFT-1)
+#else
+#define SPLIT_CHANNEL_SHIFT 0
+#endif
+
 #define SAMPLE_RATE 16000.0
 #define UPDATE_RATE 8000
 #define TIMER1_MAX 65535
 #define TIMER1_FREQUENCY 2000000
 #define ENVELOPE_DIVIDER 4           // This is similar to a prescaler, we do not update the envelope every cycle we do it ever cycle/ENVELOPE_DIVIDER
 #define MODULATION_PITCH_DIVIDER 800 // This is the same concept as above, we update the modulation pitch every cycle/MODULATION_PITCH_DIVIDER
+#define RENDER_BLOCK_MAX 64           // render works through the requested samples in blocks of up to this many, each block costs RENDER_BLOCK_MAX*2 bytes of stack for the mix, twice that in split and pan modes
+#define MIPMAP_LEVELS 8               // the number of band limited levels in a mipmapped wave table, see CVoice::setMipmap
+#define EVENT_QUEUE_SIZE 8            // the number of notes which can be queued with queueTrigger and queueMidi, must be a power of 2
+
+// The size in bytes of the queue which carries voice setups and triggers from the sketch to render, a power of 2 no bigger
+// than 256. A setup takes 2+2*sizeof(uintptr_t)+6 bytes - 12 on the Arduino - a trigger 2 to 4 and the other settings 2
+// to 10. One byte is always left empty (see CIllutronB::openCommand) so the queue holds one byte less than its size.
+// Setting up and triggering all four voices between two blocks, as the demo sketch does when a sound is chosen, takes
+// 4*12 + 4*4 = 64 bytes, one more than a 64 byte queue holds, so the Arduino has 128 with room to spare for pans and the
+// output mode. The extra 64 bytes of RAM are paid for many times over by the sequences now being in flash. A host build
+// with lots of voices has more room.
+#ifndef COMMAND_QUEUE_SIZE
+#if defined(__AVR__)
+#define COMMAND_QUEUE_SIZE 128
+#else
+#define COMMAND_QUEUE_SIZE 256
+#endif
+#endif
+
+#if (COMMAND_QUEUE_SIZE > 256) || (COMMAND_QUEUE_SIZE & (COMMAND_QUEUE_SIZE-1))
+#error COMMAND_QUEUE_SIZE must be a power of 2 no bigger than 256 - the queue positions are counted in 8 bits
+#endif
+
+// Host only - when the compiler is targeting a PC with SSE2 (all 64 bit x86) or ARM with NEON the voices are mixed
+// 8 or 16 samples at a time using vector instructions, the result is exactly the same as the plain C++ mix.
+// Add -DILLUTRONB_NO_SIMD to the host build to use the plain C++ mix, for example to check they are the same.
+#if !defined(__AVR__) && !defined(ILLUTRONB_NO_SIMD) && (defined(__SSE2__) || defined(__ARM_NEON))
+#define ILLUTRONB_SIMD
+#endif
+
+// Profiling - AVR only, uncomment ILLUTRONB_PROFILE to have the backend time the timer interrupt and the rendering of each
+// block using timer 1, see getISRCycles, getRenderCycles and getCPULoad below. The timing itself adds a little to the cost of both.
+// Uncomment ILLUTRONB_PROFILE_SCOPE as well to set analog pin A0 high while in the interrupt and A1 high while rendering
+// so you can measure them on a scope without the overhead of the counters.
+//#define ILLUTRONB_PROFILE
+//#define ILLUTRONB_PROFILE_SCOPE
+
+// No float - the AVR has no floating point hardware, every float sum is a call into the soft float library costing
+// hundreds of cycles and a couple of kilobytes of flash. Nothing the synth does while it plays uses float - setBPM,
+// the triggers and getFrequencyFromMidiNoteNumber are integer maths or table look ups - the only float left is in
+// setup and setADSR which take seconds and hertz. Uncomment ILLUTRONB_NO_FLOAT to take those two out of the library
+// altogether, then set voices up with presets (VOICE_PRESET, setPreset) and envelopes with ADSR_RATE and setADSRRates,
+// which do the float sums when the sketch is built. Anything that still uses float is then a compile error rather
+// than a surprise in the size of the sketch. The host tools check the core builds this way, see IllutronB_render.cpp.
+//#define ILLUTRONB_NO_FLOAT
 
 // using the following you can make your own defines i.e. in your sketch #define BASS CHANNEL_0
 #define CHANNEL_0 0
@@ -50,6 +173,28 @@
 #define CHANNEL_3 3
 
 
+// A voice preset - everything CVoice::setup sets, already worked out as the numbers render uses so that applying it
+// is just copying it into the command queue, there is no float maths. Keep presets in flash and make them with
+// VOICE_PRESET, it does the same sums as setup but the compiler does them once when the sketch is built.
+// See CVoice::setPreset and Presets.h for the demo presets.
+struct SVoicePreset
+{
+  const signed char *pWaveTable;
+  const unsigned char *pEnvelope;
+  uint16_t unEnvelopePhaseIncrement;
+  uint16_t unPitch;
+  uint16_t unMod;
+};
+
+#define VOICE_PRESET_ENVELOPE_INCREMENT(length) ((uint16_t)(unsigned int)((1.0/(float)(length))/(SAMPLE_RATE/(32767.5*10.0))))
+#define VOICE_PRESET_PITCH(pitch) ((uint16_t)(float)((float)(pitch)/(SAMPLE_RATE/TIMER1_MAX)))
+#define VOICE_PRESET(waveform,pitch,envelope,length,mod) \
+  {waveform,envelope,VOICE_PRESET_ENVELOPE_INCREMENT(length),VOICE_PRESET_PITCH(pitch),mod}
+
+// The rate of an ADSR stage lasting a number of seconds, the same sum as setADSR does but worked out when the sketch
+// is built - pass a constant. See CVoice::setADSRRates.
+#define ADSR_RATE_FLOAT(seconds) (65535.0/((seconds)*(UPDATE_RATE/(ENVELOPE_DIVIDER+1))))
+#define ADSR_RATE(seconds) ((uint16_t)(!(ADSR_RATE_FLOAT(seconds) < 65535.0) ? 65535 : ((ADSR_RATE_FLOAT(seconds) < 1.0) ? 1 : ADSR_RATE_FLOAT(seconds))))
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 //
@@ -63,123 +208,363 @@
 class CIllutronB
 {
 public:
-  // nothing to do in the constructor - all member variables and functions are static
-  CIllutronB(){};
+  // Each CIllutronB is a complete synth with its own voices and beat counter. The Arduino has one timer and one output
+  // so it has one synth - the global IllutronB declared at the end of this file - but a host build can have as many
+  // as it likes, for example one for each of a set of patterns being rendered at the same time.
+  CIllutronB();
   
-  // setup and start the timers
-  static void initSynth();
+  // setup and start the timers, this synth is the one we hear - AVR only, see IllutronB_avr.cpp
+  void initSynth();
+
+  // put the voices, the beat counter and the envelope divider back to how they are at power on
+  void reset();
   
   // simple counters that can be used outside CIllutronB for sequencing
   // beatComplete will return true if a new beat has been completed
-  static void setBPM(uint8_t sBPM);
-  static unsigned char beatComplete();
+  void setBPM(uint8_t sBPM);
+  unsigned char beatComplete();
+
+  // the number of samples render will calculate before the current beat completes
+  // a host build can use this to render up to the beat and trigger the next notes on exactly the right sample
+  uint32_t getSamplesToBeat();
 
-  // Timer interrupt for output compare register A on timer 1
+  // Sample accurate notes - on the Arduino the sound is rendered a little ahead of the output and loop can be held up by
+  // Serial and the like, so a note triggered straight away from loop starts a little late by a different amount each time.
+  // Instead queue the note with the time it should start and render will start it on exactly that sample.
+  // Times are counted in samples from when the synth was created, getSampleTime is the time of the next sample render
+  // will calculate and getNextBeatTime is the time the current beat completes - the demo sketch queues the notes for the
+  // next step of the sequence at this time. Notes must be queued in time order, a note queued for a time which has already
+  // been rendered starts straight away. queueTrigger plays the voices last note (see CVoice::trigger) and queueMidi plays
+  // a midi note (see CVoice::triggerMidi), both return false if the queue is full.
+  bool queueTrigger(uint32_t ulTime, uint8_t sVoice);
+  bool queueMidi(uint32_t ulTime, uint8_t sVoice, unsigned char sNote);
+  uint32_t getSampleTime();
+  uint32_t getNextBeatTime();
+
+  // Timer interrupt for output compare register A on timer 1 - AVR only, see IllutronB_avr.cpp
   static void OCR1A_ISR() __attribute__((always_inline)); 
 
-  // Forward declaration of the CIllutronB::CVoice class
-  class CVoice;
-  // An array holding the 4 CIllutronB::CVoice objects.
-  static CVoice m_Voices[CHANNEL_MAX];
+  // AVR only - the timer interrupt plays samples from a FIFO, fillBuffer renders new samples into the FIFO
+  // whenever there is room for another block. Call it from loop as often as you can, the FIFO holds 16ms of sound.
+  // getUnderruns returns the number of times the interrupt found the FIFO empty because fillBuffer was not called in time.
+  // There is one FIFO, the interrupt and getUnderruns belong to the hardware rather than to a synth and so are static.
+  void fillBuffer();
+  static uint16_t getUnderruns();
 
-protected:
-  
-  static volatile unsigned int m_unBPMCounterStart;   // m_unBPMCounter counts down from m_unBPMCounterStart
-  static volatile unsigned int m_unBPMCounter;        //- on zero sets m_sBeat to indicate a beat at the required BPM has completed and starts the next count down fom m_unBPMCounterStart
-  static volatile unsigned char m_sBeatComplete;      //- Flags that a beat is complete, can be ignored or used by user code to trigger a new beat automatically - accessed through beatComplete function
-  static volatile unsigned char m_sEnvelopeDivider;   //- We update the envelope every fourth ENVELOPE_DIVIDER, this counts down from ENVELOPE_DIVIDER to 0 and is used to update the envelope at 0 before staring another countdown from ENVELOPE_DIVIDER
-  static volatile unsigned int m_unEnvelopePitchModulationDivider; // We update envelope pitch modulations every MODULATION_PITCH_DIVIDER samples, similar to above.
-};
+#if defined(ILLUTRONB_PROFILE)
+  // AVR only - the timer interrupt has a budget of 125us = 2000 cycles per sample to share with the rendering and
+  // everything else the sketch does. These report where it is going, cycle counts are measured in timer 1 ticks so 
+  // they are accurate to 8 cycles.
+  struct SCycles
+  {
+    uint16_t unMin;
+    uint16_t unAverage;
+    uint16_t unMax;
+  };
+  static void getISRCycles(SCycles &cycles);    // cycles spent in each timer interrupt
+  static void getRenderCycles(SCycles &cycles); // cycles spent rendering each sample, measured over a block and divided by the block size
+  static uint8_t getCPULoad();                  // the percentage of the time spent in the interrupt and rendering, averaged over the last few blocks
+  static void resetProfile();                   // start again with the min, max and averages
+#endif
 
-// The voices are a bit like individual instruments with thier own sound characteristics
-// In the demo you can hear drum, bass, chord and percussion for example.
-// Each of these is being generated by one of the four voices.
-// 
-// The CIllutronB::CVoice class records the voice configuration which determines the sound it makes
-// Its actually very powerful, the full range of sounds in the demo are all coming from the same Voice class
-// just with four different configurations.
-//
-// The voice class also contains functions which perform the calculations required to generate sound from an individual voice
-// The CIllutronB then mixes the sounds together to produce the output.
-class CIllutronB::CVoice
-{
-public:
-  CVoice();
+  // The render core - calculates the next 'frames' mixed output samples, advancing the envelopes and the beat counter
+  // The AVR backend offsets these by 127 and writes them to the PWM output, a host build can do what it likes with them.
+  // There are two outputs, A and B, see setOutputMode - the first version gives just output A.
+  void render(int8_t *pOut, size_t frames);
+  void render(int8_t *pOutA, int8_t *pOutB, size_t frames);
+
+  // The Arduino has two PWM outputs on timer 0, A on digital pin 6 and B on digital pin 5. setOutputMode chooses how
+  // the voices are shared between them -
+  //   OUTPUT_MONO - all of the voices on both outputs, the same sound on both pins. This is how the synth has always sounded.
+  //   OUTPUT_SPLIT - the first half of the voices on A and the second half on B, voices 0 and 1 on pin 6 and 2 and 3 on pin 5.
+  //                  Each output mixes half as many voices so it is scaled down by half as much and keeps more detail.
+  //   OUTPUT_PAN - each voice is placed between A and B by CVoice::setPan, for stereo. A voice can be all the way over to
+  //                one side so each output is scaled down as much as it is in mono.
+  // The new mode starts at the next block, the mode does not change how long it takes to work out the voices.
+  enum
+  {
+    OUTPUT_MONO = 0,
+    OUTPUT_SPLIT = 1,
+    OUTPUT_PAN = 2
+  };
+  bool setOutputMode(uint8_t sMode);
+
+  // The voices are a bit like individual instruments with thier own sound characteristics
+  // In the demo you can hear drum, bass, chord and percussion for example.
+  // Each of these is being generated by one of the four voices.
+  // 
+  // The CIllutronB::CVoice class records the voice configuration which determines the sound it makes
+  // Its actually very powerful, the full range of sounds in the demo are all coming from the same Voice class
+  // just with four different configurations.
+  //
+  // The voice class also contains functions which perform the calculations required to generate sound from an individual voice
+  // The CIllutronB then mixes the sounds together to produce the output.
+  //
+  // The setups, triggers and settings below are all sent to render through the command queue (see COMMAND_QUEUE_SIZE),
+  // each returns false if the queue was full and nothing was sent - the note or the change is lost, so try again after
+  // the next block has been rendered. setOutputMode above works the same way.
+  class CVoice
+  {
+  public:
+    CVoice();
   
-  void setWave(unsigned int waveData);
-  void setEnvelope(unsigned int envelopeData);
+    // wave and envelope tables are passed as addresses - (uintptr_t)SinTable - this is 16 bits on AVR and wide enough for a pointer on a PC
+    void setWave(uintptr_t waveData);
+    void setEnvelope(uintptr_t envelopeData);
     
-  void setup(unsigned int waveform, float pitch, unsigned int envelope, float length, unsigned int mod);
+#if !defined(ILLUTRONB_NO_FLOAT)
+    bool setup(uintptr_t waveform, float pitch, uintptr_t envelope, float length, unsigned int mod);
+#endif
+
+    // the same as setup with the values from a preset in flash, see SVoicePreset
+    bool setPreset(const SVoicePreset *pPreset);
   
-  // Three ways to play (trigger) a note - 
+    // Three ways to play (trigger) a note - 
   
-  // play a midi note using the midi note number - 
-  void triggerMidi(unsigned char note);
+    // play a midi note using the midi note number - 
+    bool triggerMidi(unsigned char note);
   
-  // play the note using whatever pith it was last played at (probably the one set initially in setup)
-  void trigger();
+    // play the note using whatever pith it was last played at (probably the one set initially in setup)
+    bool trigger();
   
-  // play a pitch based on the pitches defined in the pitches.h header file supplied with Arduino Tone Examples
-  void triggerPitch(uint16_t sPitch);
+    // play a pitch based on the pitches defined in the pitches.h header file supplied with Arduino Tone Examples
+    bool triggerPitch(uint16_t sPitch);
+
+    // Normally each sample is the wave table entry the wave phase accumulator is pointing at, at low pitches the same
+    // entry is played for several samples in a row and the wave comes out as a staircase which you can hear as a buzz.
+    // With interpolation turned on the voice blends each entry with the next one depending on how far the accumulator
+    // is between them, which smooths out the steps. It costs a little more - see getInterpolatedWave in IllutronB.cpp -
+    // and is off for a new voice so the synth sounds exactly as it always has until you ask for it.
+    bool setInterpolation(bool bInterpolate);
 
-// These are used by the CIllutronB class and should really be protected ->
-// They essentially do the maths required to generate the output for the voice
-  signed char getSample(uint8_t,uint8_t) __attribute__((always_inline)); // get the output value for this voice, the systh will mix this with the outputs for the other voices to generate the output sound
+    // The saw, ramp and square tables have sharp edges, an edge is made of harmonics all the way up and at high notes the
+    // harmonics above half the sample rate fold back down as notes which are not in the music (aliasing). The mipmapped
+    // versions - SawMipmap in saw256mip.h and so on, made by IllutronB_host/IllutronB_mipmap - hold MIPMAP_LEVELS copies
+    // of the table each with half the harmonics of the one before. Pass one to setup and then call setMipmap(true) and
+    // whenever a note starts the voice picks the copy with as many harmonics as that note can play without aliasing.
+    // The choice is made once per note so it costs nothing per sample. setup turns it off again, a plain table only has one copy.
+    bool setMipmap(bool bMipmap);
 
-// I am not convinced that the maths or even the approach is right to midi pitch generation
-// so will confirm and or revise/remove this function
-  unsigned int getFrequencyFromMidiNoteNumber(unsigned char note);
+    // An envelope table can only be changed by making a new table and each one takes 512 bytes of flash. Instead a voice
+    // can work its envelope out as it plays, in four straight line stages -
+    //   attack - the time in seconds to rise from silence to full volume when the note starts
+    //   decay - the time in seconds it would take to fall from full volume to silence, it stops falling at the sustain level
+    //   sustain - the volume, 0 to 255, the note holds at until release is called
+    //   release - the time in seconds it would take to fall from full volume to silence after release is called
+    // A sustain of 0 gives an attack/decay envelope which finishes on its own, like a drum - there is no need to call release.
+    // Call it after setup, setup goes back to the envelope table. The envelope table passed to setup is not used
+    // while the voice has an ADSR envelope, the length still sets how long the pitch modulation takes.
+#if !defined(ILLUTRONB_NO_FLOAT)
+    bool setADSR(float attack, float decay, unsigned char sustain, float release);
+#endif
+
+    // setADSR with the rates already worked out - ADSR_RATE(seconds) for each of attack, decay and release - so there
+    // is no float maths when the sketch runs, this is all there is with ILLUTRONB_NO_FLOAT.
+    bool setADSRRates(uint16_t unAttack, uint16_t unDecay, unsigned char sustain, uint16_t unRelease);
+
+    // where the voice sits between the two outputs in OUTPUT_PAN mode - 0 is only output A, 255 is only output B and 128,
+    // the default, is exactly in the middle
+    bool setPan(uint8_t sPan);
+
+    // let go of the note on a voice with an ADSR envelope, it fades out over the release time
+    bool release();
+
+    // the frequency of a midi note in whole hertz, from a table of the top octave in flash - see IllutronB.cpp
+    unsigned int getFrequencyFromMidiNoteNumber(unsigned char note);
 
-  // added to support visualisation
-  unsigned char getAmplitude();
+    // added to support visualisation
+    unsigned char getAmplitude();
   
-protected:
-  // All wave table synths work in the same way - the synth cycles through an array of values
-  // which represent a waveform - the faster the cycle, the higher the frequency
+  protected:
+    friend class CIllutronB;
+
+    // A voice does not hold its configuration itself - setup and the triggers send it to render through the synths
+    // command queue (see CIllutronB::openCommand) and render keeps it in m_VoiceState along with the parts that change
+    // as the voice plays. The voice only needs to know which synth and which voice it is, CIllutronB sets these up.
+    CIllutronB *m_pSynth;
+    uint8_t m_sVoice;
+
+    // setup and setPreset both end up here to send the voice configuration to render
+    bool sendSetup(uintptr_t waveform, uintptr_t envelope, uint16_t unEnvelopePhaseIncrement, uint16_t unPitch, uint16_t unMod);
+
+    // All wave table synths work in the same way - the synth cycles through an array of values
+    // which represent a waveform - the faster the cycle, the higher the frequency
   
-  // See - todo link - for plots of the CIllutronB waveform arrays
+    // See - todo link - for plots of the CIllutronB waveform arrays
 
-  // Waveform related parameters - 
-  volatile unsigned int m_unWaveTableStart;      // To assign a wavetable to a voice, all we do is point the m_unWaveTableStart member of the voice to the address of the wave table array in memory
-  volatile unsigned int m_unWavePhaseAccumulator; // The WaveTablePhaseAccumulator sound complicated because it is based on established wave table terminology - in reality is just an index into the array pointed to by m_unWaveTableStart
-  volatile unsigned int m_unWavePhaseIncrement;   // Again we are following established wave table synth terminology - in simpler terms, this is just added to the wave phase accumulator each cycle
-                                                  // a low value means we step through the wave table slowly producing a low frequency bass sound, a high value means we step through more quickly producing
-                                                  // a high frequency treble sound.
+    // Waveform related parameters - all of these live in CIllutronB::m_VoiceState and are described here with the rest of the voice.
+    // m_VoiceState.unWaveTableStart                // To assign a wavetable to a voice, all we do is point unWaveTableStart to the address of the wave table array in memory
+    // m_VoiceState.unWavePhaseAccumulator          // The WaveTablePhaseAccumulator sound complicated because it is based on established wave table terminology - in reality is just an index into the array pointed to by unWaveTableStart
+    // m_VoiceState.unWavePhaseIncrement            // Again we are following established wave table synth terminology - in simpler terms, this is just added to the wave phase accumulator each cycle
+                                                    // a low value means we step through the wave table slowly producing a low frequency bass sound, a high value means we step through more quickly producing
+                                                    // a high frequency treble sound.
 
-  volatile unsigned int m_unPitch;                // This is the original pitch assigned to the sound - the synth includes some capabilities to bend a note away from
-                                                  // its original pitch over the duration of the note - we use this to record the original note pitch
-                                                  // Duane B TODO - I dont think pitch is an accurate description of the variables nature and should revisit this.
+    // m_VoiceState.unPitch                         // This is the original pitch assigned to the sound - the synth includes some capabilities to bend a note away from
+                                                    // its original pitch over the duration of the note - we use this to record the original note pitch
+                                                    // Duane B TODO - I dont think pitch is an accurate description of the variables nature and should revisit this.
 
-  // Wave tables on thier own produce a sound which is not that interesting, 
-  // in order to produce musical content they are always combined with an envelope.
-  //
-  // The envelope controls how the sound develops over time, for example - 
-  //    A drum hit has an explosive beginning and decays away quickly
-  //    A bowed violin string sound begins and ends more slowly.
-  // By combining the wavetable with an envelope table we are able to create sounds which are form more
-  // engaging and can reproduce the sounds of specific instruments.
-  //
-  // See TODO Link for an example of wavetables combined with envelopes  
+    // Wave tables on thier own produce a sound which is not that interesting, 
+    // in order to produce musical content they are always combined with an envelope.
+    //
+    // The envelope controls how the sound develops over time, for example - 
+    //    A drum hit has an explosive beginning and decays away quickly
+    //    A bowed violin string sound begins and ends more slowly.
+    // By combining the wavetable with an envelope table we are able to create sounds which are form more
+    // engaging and can reproduce the sounds of specific instruments.
+    //
+    // See TODO Link for an example of wavetables combined with envelopes  
   
-  // The Envelope is very similar to the wave table in that its an array stored in memory, we assign an envelope to a voice
-  // by pointing the m_unEnvelopeTableStart member of the CVoice class to the start of the envelope in memory.
-  volatile unsigned int m_unEnvelopeTableStart;          // The start of the array representing the envelope
-  volatile unsigned int m_unEnvelopePhaseAccumulator;    // The current position in the envelope - Note - unlike the wave form, we only cycle through the envelope once, 
-                                                         // it describes the life (volume really) of a note from start to finish.
-  volatile unsigned int m_unEnvelopePhaseIncrement;      // This controls how fast we move through the envelope table, high values will be fast giving an abrupt note like a drum or percussion
-                                                         // lower values will give a prolonged note.
+    // The Envelope is very similar to the wave table in that its an array stored in memory, we assign an envelope to a voice
+    // by pointing unEnvelopeTableStart to the start of the envelope in memory.
+    // m_VoiceState.unEnvelopeTableStart                   // The start of the array representing the envelope
+    // m_VoiceState.unEnvelopePhaseAccumulator             // The current position in the envelope - Note - unlike the wave form, we only cycle through the envelope once, 
+                                                           // it describes the life (volume really) of a note from start to finish.
+    // m_VoiceState.unEnvelopePhaseIncrement               // This controls how fast we move through the envelope table, high values will be fast giving an abrupt note like a drum or percussion
+                                                           // lower values will give a prolonged note.
                                                          
-  volatile unsigned char m_sAmplitude;                   // This records the most recent value read from the wavetable - its a more efficient than reading and calculating each time.
-                                                         // also we do not calculate the amplitude continually, there is a divider - see m_sEnvelopeDivider.
-                                                         // m_sAmplitude will always have a cache of the most recent value
+    volatile unsigned char m_sAmplitude;                   // A copy of m_VoiceState.sAmplitude made at the end of each block for getAmplitude -
+                                                           // This records the most recent value read from the wavetable - its a more efficient than reading and calculating each time.
+                                                           // also we do not calculate the amplitude continually, there is a divider - see m_sEnvelopeDivider.
+                                                           // sAmplitude will always have a cache of the most recent value
                                                          
-                                                         // It also have a secondary use, its effectively the current power level of the channel and is ideal for driving
-                                                         // a visualised - for example PWM of an LED for each channel
-                                                         // or use a shift register to drive a set of LEDs for each channel
+                                                           // It also have a secondary use, its effectively the current power level of the channel and is ideal for driving
+                                                           // a visualised - for example PWM of an LED for each channel
+                                                           // or use a shift register to drive a set of LEDs for each channel
                                                          
-                                                         // You can build a night club in a box !
+                                                           // You can build a night club in a box !
+
+    // m_VoiceState.nEnvelopePitchModulation               // The allows a note to increase or decrease in pitch as its played, for instance a bass sound that drops as it decays
+  };
+
+  // An array holding the 4 CIllutronB::CVoice objects.
+  CVoice m_Voices[CHANNEL_MAX];
+
+// These are used by render and should really be protected, they are public so the host benchmarks can time one voice ->
+  // apply the setups and triggers waiting in the command queue to the render state, render does this at the start of every block
+  void syncVoices();
+  // add the next sFrames output values for voice sVoice to pMix, the synth mixes the outputs of all the voices this way to generate the output sound
+  // pass pMixB as well to pan the voice between pMix and pMixB in OUTPUT_PAN mode, NULL otherwise
+  // sEnvelopeDivider is the synths envelope divider at the start of the block - it tells us which samples should update the envelope
+  void renderVoice(uint8_t sVoice, int16_t *pMix, int16_t *pMixB, uint8_t sFrames, uint8_t sEnvelopeDivider);
+
+protected:
+  // renders one block of up to RENDER_BLOCK_MAX samples, render breaks larger requests into blocks
+  void renderBlock(int8_t *pOutA, int8_t *pOutB, uint8_t sFrames);
+  uint8_t m_sOutputMode;                       // see setOutputMode, only render changes it - setOutputMode sends a command
+
+  // The render state of the voices - thier configuration and the parts of each voice which change as it plays.
+  // The sketch configures and triggers the voices through m_Voices which send commands to render, render only looks
+  // at the commands once per block in syncVoices and then works from here. Rather than an array of voices we keep an array for each value, all the
+  // wave phase accumulators together, all the amplitudes together and so on. Nothing in here is volatile so render
+  // can keep a voice in registers for a whole block and on a PC the compiler can work on several voices at once.
+  struct SVoiceState
+  {
+    uintptr_t unWaveTableStart[CHANNEL_MAX];           // see the CVoice members of the same name for a description of each of these
+    uintptr_t unWaveLevelStart[CHANNEL_MAX];           // the table render plays - unWaveTableStart or the mipmap level chosen by startNote
+    uint16_t unWavePhaseAccumulator[CHANNEL_MAX];
+    uint16_t unWavePhaseIncrement[CHANNEL_MAX];
+    uintptr_t unEnvelopeTableStart[CHANNEL_MAX];
+    uint16_t unEnvelopePhaseAccumulator[CHANNEL_MAX];
+    uint16_t unEnvelopePhaseIncrement[CHANNEL_MAX];
+    uint8_t sAmplitude[CHANNEL_MAX];
+    uint16_t unPitch[CHANNEL_MAX];
+    int16_t nEnvelopePitchModulation[CHANNEL_MAX];
+    uint8_t sInterpolate[CHANNEL_MAX];                 // see CVoice::setInterpolation
+    uint8_t sMipmap[CHANNEL_MAX];                      // see CVoice::setMipmap
+    uint8_t sEnvelopeStage[CHANNEL_MAX];               // the ADSR envelope - see CVoice::setADSR. The volume is kept in 16 bits
+    uint16_t unEnvelopeLevel[CHANNEL_MAX];             // so that slow stages can move by less than one step of the 8 bit amplitude
+    uint16_t unAttackRate[CHANNEL_MAX];                // at each envelope update, the rates are added to or taken away from it
+    uint16_t unDecayRate[CHANNEL_MAX];
+    uint16_t unSustainLevel[CHANNEL_MAX];
+    uint16_t unReleaseRate[CHANNEL_MAX];
+    uint8_t sPan[CHANNEL_MAX];                         // see CVoice::setPan
+  };
+  SVoiceState m_VoiceState;
 
-  volatile int m_nEnvelopePitchModulation;               // The allows a note to increase or decrease in pitch as its played, for instance a bass sound that drops as it decays
+  // silence voice sVoice and go back to the default configuration, as it is at power on
+  void resetVoice(uint8_t sVoice);
+  // start the envelope of voice sVoice again to play a note
+  void startNote(uint8_t sVoice);
+  // bend the pitch of each sounding voice by its envelope pitch modulation, render does this every MODULATION_PITCH_DIVIDER samples
+  void modulatePitch();
+
+  // The command queue - CVoice::setup and the triggers used to turn off interrupts while they changed the voice so that
+  // render never saw half a change, which could delay the timer interrupt enough to hear it when several voices were
+  // changed on the same beat. Now they write a command into this queue and render reads the commands at the start of
+  // the next block, one side writes and the other side reads so neither ever has to stop the other.
+  //
+  // A command is a command byte, a voice byte and then the values which go with the command. The writer opens a command,
+  // puts its values and closes it, the reader does not see any of it until it is closed so it never sees half a command.
+  // m_sCommandRead and m_sCommandWrite are free running - the queue holds m_sCommandWrite - m_sCommandRead bytes -
+  // only syncVoices changes m_sCommandRead and only closeCommand changes m_sCommandWrite. m_sCommandPut is where
+  // the writer is putting the command it has open, only the writer uses it.
+  enum
+  {
+    COMMAND_SETUP = 0,          // wave table, envelope table, envelope phase increment, pitch, pitch modulation
+    COMMAND_TRIGGER = 1,        // nothing, play the last note again
+    COMMAND_TRIGGER_MIDI = 2,   // pitch, which is also the new wave phase increment
+    COMMAND_TRIGGER_PITCH = 3,  // wave phase increment
+    COMMAND_INTERPOLATION = 4,  // 1 to turn interpolation on, 0 to turn it off
+    COMMAND_MIPMAP = 5,         // 1 if the wave table is mipmapped, 0 if it is not
+    COMMAND_ADSR = 6,           // attack rate, decay rate, sustain level, release rate
+    COMMAND_RELEASE = 7,        // nothing, start the release stage
+    COMMAND_PAN = 8,            // pan
+    COMMAND_OUTPUT_MODE = 9     // output mode, this is for the whole synth and the voice byte is not used
+  };
+
+  // The stage an ADSR envelope is at - see CVoice::setADSR. A voice with an envelope table is always at ENVELOPE_TABLE.
+  enum
+  {
+    ENVELOPE_TABLE = 0,
+    ENVELOPE_ATTACK = 1,
+    ENVELOPE_DECAY = 2,
+    ENVELOPE_SUSTAIN = 3,
+    ENVELOPE_RELEASE = 4,
+    ENVELOPE_OFF = 5
+  };
+  bool openCommand(uint8_t sCommand, uint8_t sVoice, uint8_t sLength);
+  void putCommand(uint16_t unValue);
+  void putCommandAddress(uintptr_t unAddress);
+  void closeCommand();
+  uint16_t getCommand(uint8_t &sRead);
+  uintptr_t getCommandAddress(uint8_t &sRead);
+  volatile uint8_t m_sCommands[COMMAND_QUEUE_SIZE];
+  volatile uint8_t m_sCommandRead;
+  volatile uint8_t m_sCommandWrite;
+  uint8_t m_sCommandPut;
+
+  // The queue of notes waiting for thier time to come - see queueTrigger. m_sEventRead and m_sEventWrite are free running,
+  // the queue holds m_sEventWrite - m_sEventRead notes. Like the command queue only render changes m_sEventRead and
+  // only queueEvent changes m_sEventWrite, the other side reads them with ILLUTRONB_QUEUE_LOAD.
+  enum
+  {
+    EVENT_TRIGGER = 0,
+    EVENT_MIDI = 1
+  };
+  struct SEvent
+  {
+    uint32_t ulTime;
+    uint8_t sVoice;
+    uint8_t sType;
+    unsigned char sNote;
+  };
+  bool queueEvent(uint32_t ulTime, uint8_t sVoice, uint8_t sType, unsigned char sNote);
+  SEvent m_Events[EVENT_QUEUE_SIZE];
+  uint8_t m_sEventRead;
+  uint8_t m_sEventWrite;
+  uint32_t m_ulSampleTime;                     // the number of samples rendered since the synth was created
+  uint16_t m_unModulationCounter;              // the number of samples until render next calls modulatePitch
+  
+  volatile uint16_t m_unBPMCounterStart;       // m_unBPMCounter counts down from m_unBPMCounterStart
+  volatile uint16_t m_unBPMCounter;            //- on zero sets m_sBeat to indicate a beat at the required BPM has completed and starts the next count down fom m_unBPMCounterStart
+  volatile unsigned char m_sBeatComplete;      //- Flags that a beat is complete, can be ignored or used by user code to trigger a new beat automatically - accessed through beatComplete function
+  volatile unsigned char m_sEnvelopeDivider;   //- We update the envelope every fourth ENVELOPE_DIVIDER, this counts down from ENVELOPE_DIVIDER to 0 and is used to update the envelope at 0 before staring another countdown from ENVELOPE_DIVIDER
 };
 
+
+#if defined(__AVR__)
+// The synth we hear on the Arduino - the timer interrupt plays the samples it renders, see IllutronB_avr.cpp
+extern CIllutronB IllutronB;
+#endif
+
 #endif
@@ -0,0 +1,269 @@
+#ifndef ILLUTRONB
+#include "IllutronB.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// IllutronB AVR backend
+//
+// This is the only part of the synth which knows about the AVR hardware - the timers, the interrupt and the PWM output.
+// All of the sound generation is done by the render core in IllutronB.cpp which can also be built and run on a PC.
+//
+// A host build simply leaves this file out, the #if below means it compiles to nothing if it is picked up by mistake.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__AVR__)
+
+// Bitwise operations - set bit, clear bit, check bit, toggle bit
+// TODO - there must be standard Arduino definitions for these, if so replace the these and use the standard versions
+#define SET(x,y) (x |=(1<<y))		        					//-Bit set/clear macros
+#define CLR(x,y) (x &= (~(1<<y)))       						// |
+#define CHK(x,y) (x & (1<<y))           						// |
+#define TOG(x,y) (x^=(1<<y))            						//-+
+
+#if defined(ILLUTRONB_PROFILE)
+// Profiling - we time the interrupt and each block rendered by fillBuffer using timer 1 which is already running at 2MHz,
+// each tick of timer 1 is 8 cycles of the 16MHz CPU. Timer 1 is 16 bits and wraps every 32ms, which is far longer than
+// anything we time, so a simple subtraction gives us the ticks even when it has wrapped.
+#define CYCLES_PER_TIMER1_TICK (F_CPU/TIMER1_FREQUENCY)
+
+struct SProfileCounter
+{
+  uint16_t unMin;
+  uint16_t unMax;
+  uint32_t ulTotal;
+  uint16_t unCount;
+};
+
+static SProfileCounter sISRProfile = {0xFFFF,0,0,0};    // ticks per interrupt - written by the interrupt
+static SProfileCounter sRenderProfile = {0xFFFF,0,0,0}; // ticks per block - written by fillBuffer
+static volatile uint16_t unISRTicksSinceBlock = 0;     // total interrupt ticks since fillBuffer last rendered a block
+static uint16_t unCPULoad = 0;                          // percentage * 256, a moving average over the last few blocks
+
+static void addProfileTicks(SProfileCounter &counter,uint16_t unTicks)
+{
+  if(unTicks < counter.unMin)
+  {
+    counter.unMin = unTicks;
+  }
+  if(unTicks > counter.unMax)
+  {
+    counter.unMax = unTicks;
+  }
+  counter.ulTotal += unTicks;
+  counter.unCount++;
+
+  // keep a long running average without overflowing, halving both keeps the same average
+  if(0x8000 == counter.unCount)
+  {
+    counter.ulTotal >>= 1;
+    counter.unCount >>= 1;
+  }
+}
+
+static void getProfileCycles(const SProfileCounter &counter,CIllutronB::SCycles &cycles,uint8_t sTicksDivider)
+{
+  if(0 == counter.unCount)
+  {
+    cycles.unMin = cycles.unAverage = cycles.unMax = 0;
+    return;
+  }
+  cycles.unMin = (counter.unMin * CYCLES_PER_TIMER1_TICK) / sTicksDivider;
+  cycles.unAverage = ((counter.ulTotal * CYCLES_PER_TIMER1_TICK) / counter.unCount) / sTicksDivider;
+  cycles.unMax = (counter.unMax * CYCLES_PER_TIMER1_TICK) / sTicksDivider;
+}
+#endif
+
+#if defined(ILLUTRONB_PROFILE_SCOPE)
+// A0 is high while we are in the interrupt, A1 while we are rendering
+#define SCOPE_ISR_PIN 0
+#define SCOPE_RENDER_PIN 1
+#endif
+
+// The synth we hear - the sketch sets up its voices and plays notes on it, fillBuffer renders it into the FIFO.
+CIllutronB IllutronB;
+
+// We use two timers to generate the sound - Timer1 provides an interrupt 8000 times a second which we use to update output
+// The output itself is through PWM using timer 0 on digital pin 6, and digital pin 5 for the second output when the
+// voices are split or panned (see CIllutronB::setOutputMode) - it is incredible that this much sound and variety of sound
+// is possible through 8 bit PWM.
+
+// This is triggered 8000 times a second, we call the CIllutronB::OCR1A_ISR() function to update the output
+// TODO consider renaming OCR1A_ISR to update ?
+// TODO Timer1 is a 16 bit timer used by the servo library among others - should look at using a less valuable 8-bit timer instead.
+SIGNAL(TIMER1_COMPA_vect)
+{
+  CIllutronB::OCR1A_ISR();
+}
+
+// Setup up the timers -
+// TODO - rename start and provide a stop function which will free up the timers
+// allowing the synth to be used periodically within a project which requires the timers
+// at other times.
+void CIllutronB::initSynth()
+{
+#if defined(ILLUTRONB_PROFILE_SCOPE)
+  SET(DDRC,SCOPE_ISR_PIN);
+  SET(DDRC,SCOPE_RENDER_PIN);
+#endif
+
+  // fill the FIFO before the interrupt starts taking samples from it
+  fillBuffer();
+
+  // Set up Timer 1 output compare interrupt A
+  // Timer 1 is basically used as a scheduler that triggers at a regular interval for use to update the synth outputs.
+  TCCR1B=0x02;          // set the timer prescaler to 8 = 16/8 = 2MHz
+  SET(TIMSK1,OCIE1A);   // Enable output compare match interrupt on OCR1A
+  sei();
+
+  // Set up the output timer - At the risk of repeating myself, it is incredible that the full sound range of the IllutronB
+  // is possible through the PWM output of just this one 8 bit timer.
+  TCCR0A=0B10110011;                                    //-8 bit audio PWM
+  //TCCR0A=0x83;          // Set timer waveform generation mode to FAST PWM, clear OC0A On match, set at bottom - OC0A = digital pin 6.
+  TCCR0B=0x01;          // Set to clock frequency, no prescaler
+  OCR0B = OCR0A=127;            // set in the middle - do we need this ? probably not.
+  SET(DDRD,5);          // Set digital pin 5 to output - OC0B, output B - channels 2 and 3 when split
+  SET(DDRD,6);          // Set digital pin 6 to output - OC0A, output A - channels 0 and 1 when split
+}
+
+// The render core is most efficient when it calculates a block of samples at a time. Rather than do this in the
+// timer interrupt, loop calls fillBuffer to render blocks into a FIFO and the interrupt does nothing more than take
+// the next sample from the FIFO and output it. This keeps the interrupt short so it no longer holds up Serial,
+// analogRead and the rest of the Arduino core and it means a block can take as long as it needs to render.
+//
+// The FIFO is two blocks long, the interrupt plays one block while fillBuffer renders the other.
+// The read and write positions are free running 8 bit counters, the FIFO size divides 256 so the number of
+// samples in the FIFO is always sFIFOWrite - sFIFORead even when they wrap around.
+// Only the interrupt changes sFIFORead and only fillBuffer changes sFIFOWrite, both are single bytes so
+// we do not need to turn off interrupts to share them.
+#define FIFO_BLOCK_SIZE 64
+#define FIFO_SIZE (2*FIFO_BLOCK_SIZE)
+
+// There is a FIFO for each output - sFIFO for A on pin 6 and sFIFOB for B on pin 5 - they share the read and write
+// positions. In mono both get the same samples, the interrupt does not need to know which mode we are in.
+static int8_t sFIFO[FIFO_SIZE];
+static int8_t sFIFOB[FIFO_SIZE];
+static volatile uint8_t sFIFORead = 0;         // the next sample the interrupt will output
+static volatile uint8_t sFIFOWrite = 0;        // where fillBuffer will render the next block
+static volatile uint16_t unFIFOUnderruns = 0;  // the number of samples we could not output because the FIFO was empty
+
+// The hardware side of the update - schedule the next interrupt and output the next sample
+// The render core gives us a signed sample centred on 0, the PWM duty cycle is centred on 127.
+void CIllutronB::OCR1A_ISR()
+{
+#if defined(ILLUTRONB_PROFILE_SCOPE)
+  SET(PORTC,SCOPE_ISR_PIN);
+#endif
+#if defined(ILLUTRONB_PROFILE)
+  uint16_t unStartTicks = TCNT1;
+#endif
+
+  OCR1A+=(TIMER1_FREQUENCY/UPDATE_RATE); // set timer to come back for the next update in 125us time
+
+  uint8_t sFIFOReadNow = sFIFORead;
+  if(sFIFOReadNow != sFIFOWrite)
+  {
+    // to generate the output all we are doing is updating the output compare registers A and B of timer0 to control thier duty cycles
+    uint8_t sIndex = sFIFOReadNow & (FIFO_SIZE-1);
+    OCR0A=127+sFIFO[sIndex];
+    OCR0B=127+sFIFOB[sIndex];
+    sFIFORead = sFIFOReadNow + 1;
+  }
+  else
+  {
+    // nothing to play, leave the output where it is - repeating the last sample is quieter than jumping back to the middle
+    unFIFOUnderruns++;
+  }
+
+#if defined(ILLUTRONB_PROFILE)
+  uint16_t unTicks = TCNT1 - unStartTicks;
+  addProfileTicks(sISRProfile,unTicks);
+  unISRTicksSinceBlock += unTicks;
+#endif
+#if defined(ILLUTRONB_PROFILE_SCOPE)
+  CLR(PORTC,SCOPE_ISR_PIN);
+#endif
+}
+
+// Render blocks into the FIFO until it is full - called from loop, not from the interrupt
+// There is only one FIFO so only call this on one synth, the sketch uses the global IllutronB.
+void CIllutronB::fillBuffer()
+{
+  uint8_t sFIFOWriteNow = sFIFOWrite;
+  while((uint8_t)(sFIFOWriteNow - sFIFORead) <= (FIFO_SIZE - FIFO_BLOCK_SIZE))
+  {
+#if defined(ILLUTRONB_PROFILE_SCOPE)
+    SET(PORTC,SCOPE_RENDER_PIN);
+#endif
+#if defined(ILLUTRONB_PROFILE)
+    uint16_t unStartTicks = TCNT1;
+#endif
+
+    // blocks are always written at a multiple of FIFO_BLOCK_SIZE so a block never wraps around the end of the FIFO
+    render(&sFIFO[sFIFOWriteNow & (FIFO_SIZE-1)],&sFIFOB[sFIFOWriteNow & (FIFO_SIZE-1)],FIFO_BLOCK_SIZE);
+
+#if defined(ILLUTRONB_PROFILE)
+    // note that the render time includes any interrupts which happened while we were rendering
+    uint16_t unRenderTicks = TCNT1 - unStartTicks;
+    addProfileTicks(sRenderProfile,unRenderTicks);
+
+    // a block plays for FIFO_BLOCK_SIZE interrupts, so the CPU load is the time it took to render plus the time spent in
+    // the interrupts while the last block was playing, divided by the time it takes to play a block
+    ILLUTRONB_ATOMIC_BEGIN();
+    uint16_t unISRTicks = unISRTicksSinceBlock;
+    unISRTicksSinceBlock = 0;
+    ILLUTRONB_ATOMIC_END();
+    // the render time already includes the interrupts which happened while rendering so this reads slightly high, which
+    // is the safe way round for a budget. Anything over 100% means we are falling behind and will start to underrun.
+    uint32_t ulBlockLoad = (((uint32_t)unRenderTicks + unISRTicks) * 100 * 256) / (FIFO_BLOCK_SIZE*(TIMER1_FREQUENCY/UPDATE_RATE));
+    uint16_t unBlockLoad = (ulBlockLoad > 0xFFFF) ? 0xFFFF : ulBlockLoad;
+    unCPULoad = unCPULoad - (unCPULoad >> 3) + (unBlockLoad >> 3);
+#endif
+#if defined(ILLUTRONB_PROFILE_SCOPE)
+    CLR(PORTC,SCOPE_RENDER_PIN);
+#endif
+    sFIFOWriteNow += FIFO_BLOCK_SIZE;
+    sFIFOWrite = sFIFOWriteNow;
+  }
+}
+
+uint16_t CIllutronB::getUnderruns()
+{
+  ILLUTRONB_ATOMIC_BEGIN();
+  uint16_t unUnderruns = unFIFOUnderruns;
+  ILLUTRONB_ATOMIC_END();
+  return unUnderruns;
+}
+
+#if defined(ILLUTRONB_PROFILE)
+void CIllutronB::getISRCycles(SCycles &cycles)
+{
+  ILLUTRONB_ATOMIC_BEGIN();
+  SProfileCounter profile = sISRProfile;
+  ILLUTRONB_ATOMIC_END();
+  getProfileCycles(profile,cycles,1);
+}
+
+void CIllutronB::getRenderCycles(SCycles &cycles)
+{
+  getProfileCycles(sRenderProfile,cycles,FIFO_BLOCK_SIZE);
+}
+
+uint8_t CIllutronB::getCPULoad()
+{
+  uint16_t unLoad = (unCPULoad + 128) >> 8;
+  return (unLoad > 255) ? 255 : unLoad;
+}
+
+void CIllutronB::resetProfile()
+{
+  SProfileCounter empty = {0xFFFF,0,0,0};
+  ILLUTRONB_ATOMIC_BEGIN();
+  sISRProfile = empty;
+  ILLUTRONB_ATOMIC_END();
+  sRenderProfile = empty;
+}
+#endif
+
+#endif
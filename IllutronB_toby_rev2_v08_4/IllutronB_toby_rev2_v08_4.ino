@@ -48,6 +48,8 @@
 //#include "pitches.h"
 
 #include "AmenBreak.h"
+#include "Presets.h"
+#include "Song.h"
 
 #define PLAY_BACK_BPM_PIN 7 // analog pin rev2 7  rev1 1
 #define PITCH_PIN 6         // analog pin rev2 6  rev1 2
@@ -114,33 +116,43 @@ void setup()
   pinMode(BUTTON_5,INPUT_PULLUP);
   
   
-  CIllutronB::setBPM(120);  
-  CIllutronB::initSynth();
-
-  CIllutronB::m_Voices[0].setup((unsigned int)SinTable,200.0,(unsigned int)Env0,0.4,300);
-  CIllutronB::m_Voices[1].setup((unsigned int)RampTable,100.0,(unsigned int)Env1,1.0,512);
-  CIllutronB::m_Voices[2].setup((unsigned int)TriangleTable,100.0,(unsigned int)Env2,.5,1000);
-  CIllutronB::m_Voices[3].setup((unsigned int)NoiseTable,1200.0,(unsigned int)Env3,.04,500);
+  IllutronB.setBPM(120);  
+  IllutronB.initSynth();
+
+  // the same as setup((uintptr_t)SinTable,200.0,(uintptr_t)Env0,0.4,300) and so on, see Presets.h
+  IllutronB.m_Voices[0].setPreset(&sPresets[PRESET_DEMO_KICK]);
+  IllutronB.m_Voices[1].setPreset(&sPresets[PRESET_DEMO_BASS]);
+  IllutronB.m_Voices[2].setPreset(&sPresets[PRESET_DEMO_SNARE]);
+  IllutronB.m_Voices[3].setPreset(&sPresets[PRESET_DEMO_HAT]);
 }
 
 uint8_t nCycle = 0;
 uint8_t nBeat = 0;
+int nSound = 0;     // the sound cycle_man last set up, 0 is song mode
 
 
 
 void loop()
 {
-    // The synth works in the background using a timer interrupt
+    // The synth plays in the background using a timer interrupt, but the sound itself is calculated here
+    // keep the synth topped up with sound before we do anything else, it holds 16ms so loop must come back round in less than that
+    IllutronB.fillBuffer();
+
     // Ask the IllutronB if the current beat has completed, if so lets add the next one
-    if(CIllutronB::beatComplete()) 
+    if(IllutronB.beatComplete()) 
     {
       // This is just for fun - allow the user to change the play back speed at anytime using
       // a potentiometer on analogue pin A1 - Map the potentiometer to a range of 80 to 240 BPM
       // Use this for user control of BPM
-      CIllutronB::setBPM(map (bpm_pitch ,0,1024,10,160));
-      //CIllutronB::setBPM(map(analogRead(PLAY_BACK_BPM_PIN),0,1024,10,170));        
+      IllutronB.setBPM(map (bpm_pitch ,0,1024,10,160));
+      //IllutronB.setBPM(map(analogRead(PLAY_BACK_BPM_PIN),0,1024,10,170));        
       // use this to hear the original sequence at the original play back speed
-//      CIllutronB::setBPM(140);        
+//      IllutronB.setBPM(140);        
+
+      // The notes for this step are queued to start exactly when the beat that has just started completes, rather than
+      // being triggered straight away. This way they start on exactly the right sample however long the Serial prints
+      // and the rest of loop take.
+      uint32_t ulStepTime = IllutronB.getNextBeatTime();
       
       // If there is a new beat/note for this channel, tell the Illutron B to play it
       // repeat simple repeats the note using whatever configuration it was previously given
@@ -153,242 +165,107 @@ void loop()
       Serial.print("  Beat ");     
       Serial.print(nBeat, DEC);
       
-      switch(play_track_now)
-        {
-          case 1:
-           sNote = pCurrentSequence1->getTrigger(0,nBeat);
-             break;
-          case 2:
-            sNote = pCurrentSequence2->getTrigger(0,nBeat);
-             break;
-          case 3:
-            sNote = pCurrentSequence3->getTrigger(0,nBeat);
-             break;
-          case 4:
-            sNote = pCurrentSequence4->getTrigger(0,nBeat);
-             break;
-        }
+      // all four channels of this step in one go from the sequence we are playing, see AmenBreak.h
+      STriggers triggers = pCurrentSequence->getTriggers(nBeat);
+      sNote = triggers.sNotes[0];
         
         Serial.print("  Channel 0: ");
         
       if(sNote && (gate0==0))
       {
-        CIllutronB::m_Voices[CHANNEL_0].trigger();
-       // CIllutronB::m_Voices[CHANNEL_3].trigger();
+        IllutronB.queueTrigger(ulStepTime,CHANNEL_0);
+       // IllutronB.m_Voices[CHANNEL_3].trigger();
        Serial.print(sNote  );
       }
       
       // triggerMidi allows you to trigger the channel to play back a sound at a particular note
       // it uses the midi note number, there is a look up table here - http://www.phys.unsw.edu.au/jw/notes.html
       // Notice that this is also connected to an analog input, this adjusts the base play back note.
-      switch(play_track_now)
-        {
-          case 1:
-           sNote = pCurrentSequence1->getTrigger(1,nBeat);
-             break;
-          case 2:
-            sNote = pCurrentSequence2->getTrigger(1,nBeat);
-             break;
-          case 3:
-            sNote = pCurrentSequence3->getTrigger(1,nBeat);
-             break;
-          case 4:
-            sNote = pCurrentSequence4->getTrigger(1,nBeat);
-             break;
-        }
+      sNote = triggers.sNotes[1];
         Serial.print("  Channel 1: ");
         
       if(sNote && (gate1==0))
       {
         // Use this to add user control of the pitch other wise the default will play the pitch defined in the sequence
         sNote=sNote+pitch1;
-        CIllutronB::m_Voices[CHANNEL_1].triggerMidi((sNote));
+        IllutronB.queueMidi(ulStepTime,CHANNEL_1,sNote);
         Serial.print(sNote, OCT);
         // To hear the original sequence played as intended, use the following - 
-     //  CIllutronB::m_Voices[CHANNEL_1].triggerMidi(sNote);
+     //  IllutronB.m_Voices[CHANNEL_1].triggerMidi(sNote);
       }
       
       // This is also a neat trick, it looks at the pattern in channel 2 to trigger the percussion sound
       // but uses the notes in parttern 1 to add some variety to the sound by playing it a different pitches
-      switch(play_track_now)
-        {
-          case 1:
-           sNote = pCurrentSequence1->getTrigger(2,nBeat);
-             break;
-          case 2:
-            sNote = pCurrentSequence2->getTrigger(2,nBeat);
-             break;
-          case 3:
-            sNote = pCurrentSequence3->getTrigger(2,nBeat);
-             break;
-          case 4:
-            sNote = pCurrentSequence4->getTrigger(2,nBeat);
-             break;
-        }
+      sNote = triggers.sNotes[2];
         Serial.print("  Channel 2: ");
         
         
       if(sNote && (gate2==0))
       {
         sNote=sNote+pitch2;
-        CIllutronB::m_Voices[CHANNEL_2].triggerMidi(sNote);
+        IllutronB.queueMidi(ulStepTime,CHANNEL_2,sNote);
          Serial.print(sNote, OCT);
       }
       
       // another example of simply repeating a drum sound
-      switch(play_track_now)
-        {
-          case 1:
-           sNote = pCurrentSequence1->getTrigger(3,nBeat);
-             break;
-          case 2:
-            sNote = pCurrentSequence2->getTrigger(3,nBeat);
-             break;
-          case 3:
-            sNote = pCurrentSequence3->getTrigger(3,nBeat);
-             break;
-          case 4:
-            sNote = pCurrentSequence4->getTrigger(3,nBeat);
-             break;
-        }
+      sNote = triggers.sNotes[3];
         Serial.print("  Channel 3: ");
         
       if(sNote  && (gate3==0))
       {
         // double up for a bang and then sustain using two voices, one for the bang and one for the sustain
-      //  CIllutronB::m_Voices[CHANNEL_0].trigger();
-        CIllutronB::m_Voices[CHANNEL_3].trigger();
+      //  IllutronB.m_Voices[CHANNEL_0].trigger();
+        IllutronB.queueTrigger(ulStepTime,CHANNEL_3);
         Serial.print(sNote);
       }
  
       Serial.println(" ... ");
 
+#if defined(ILLUTRONB_PROFILE)
+      // once a bar print where the time is going, see ILLUTRONB_PROFILE in IllutronB.h
+      if(0 == (nBeat & 0x0F))
+      {
+        CIllutronB::SCycles isrCycles,renderCycles;
+        CIllutronB::getISRCycles(isrCycles);
+        CIllutronB::getRenderCycles(renderCycles);
+        Serial.print("ISR cycles ");
+        Serial.print(isrCycles.unMin);Serial.print("/");Serial.print(isrCycles.unAverage);Serial.print("/");Serial.print(isrCycles.unMax);
+        Serial.print("  render cycles per sample ");
+        Serial.print(renderCycles.unMin);Serial.print("/");Serial.print(renderCycles.unAverage);Serial.print("/");Serial.print(renderCycles.unMax);
+        Serial.print("  CPU ");
+        Serial.print(CIllutronB::getCPULoad());
+        Serial.print("%  underruns ");
+        Serial.println(CIllutronB::getUnderruns());
+        CIllutronB::resetProfile();
+      }
+#endif
+
       nBeat++;      // update the beat counter
       bpm_latch++;
       bpm_latch%=4;
       
-     switch(cycle_man){ 
-     case 0:  
-      switch(nCycle)
-      {
-        case 4:
-          CIllutronB::m_Voices[3].setup((unsigned int)TriangleTable,1500.0,(unsigned int)Env3,.03,100);
-          CIllutronB::m_Voices[1].setup((unsigned int)RampTable,100.0,(unsigned int)Env1,1.0,512);
-          break; 
-       case 6:
-          CIllutronB::m_Voices[3].setup((unsigned int)TriangleTable,1500.0,(unsigned int)Env3,.03,100);
-          break;     
-        case 8:
-          CIllutronB::m_Voices[3].setup((unsigned int)NoiseTable,1500.0,(unsigned int)Env3,.03,300);
-          break;  
-        case 10:
-          CIllutronB::m_Voices[1].setup((unsigned int)TriangleTable,100.0,(unsigned int)Env1,0.6,512);
-          break;
-        case 11:
-          CIllutronB::m_Voices[1].setup((unsigned int)TriangleTable,100.0,(unsigned int)Env1,0.5,512);
-          break;    
-        case 12:
-          CIllutronB::m_Voices[1].setup((unsigned int)TriangleTable,100.0,(unsigned int)Env1,0.4,512);
-          break;
-        case 14:
-          CIllutronB::m_Voices[1].setup((unsigned int)RampTable,100.0,(unsigned int)Env1,0.5,512); 
-          break;      
-        case 15:
-          CIllutronB::m_Voices[1].setup((unsigned int)RampTable,100.0,(unsigned int)Env1,1.0,512); 
-          break;  
-        case 16:
-          CIllutronB::m_Voices[1].setup((unsigned int)RampTable,100.0,(unsigned int)Env1,0.5,512); 
-          break;    
-      }
-     case 2:
-          CIllutronB::m_Voices[1].setup((unsigned int)TriangleTable,100.0,(unsigned int)Env1,0.5,512);
-          break;      
-     case 3:
-          CIllutronB::m_Voices[1].setup((unsigned int)NoiseTable,100.0,(unsigned int)Env1,0.1,512);
-          break;
-     case 4:
-          CIllutronB::m_Voices[1].setup((unsigned int)RampTable,100.0,(unsigned int)Env1,0.5,512); 
-          break;
-     case 5:
-          CIllutronB::m_Voices[1].setup((unsigned int)SinTable,100.0,(unsigned int)Env1,1.0,512); 
-          break;          
-     case 6:
-          CIllutronB::m_Voices[2].setup((unsigned int)TriangleTable,100.0,(unsigned int)Env1,0.5,512); 
-          break;          
-     case 7:
-          CIllutronB::m_Voices[2].setup((unsigned int)NoiseTable,100.0,(unsigned int)Env1,0.8,512); 
-          break;
-     case 8:
-          CIllutronB::m_Voices[2].setup((unsigned int)RampTable,100.0,(unsigned int)Env1,0.8,512); 
-          break;          
-     case 9:
-          CIllutronB::m_Voices[2].setup((unsigned int)SinTable,100.0,(unsigned int)Env1,0.8,512); 
-          break;       
-     case 10:
-          CIllutronB::m_Voices[1].setup((unsigned int)TriangleTable,100.0,(unsigned int)Env1,0.6,512);
-          break;
-     case 11:
-          CIllutronB::m_Voices[1].setup((unsigned int)RampTable,100.0,(unsigned int)Env1,0.5,512); 
-          break;
-     case 12:
-          CIllutronB::m_Voices[1].setup((unsigned int)RampTable,100.0,(unsigned int)Env1,0.5,512); 
-          break;          
-     case 13:
-          CIllutronB::m_Voices[1].setup((unsigned int)RampTable,100.0,(unsigned int)Env1,0.5,512); 
-          break;          
-     case 14:
-          CIllutronB::m_Voices[1].setup((unsigned int)RampTable,100.0,(unsigned int)Env1,0.5,512); 
-          break;
-     case 15:
-          CIllutronB::m_Voices[1].setup((unsigned int)RampTable,100.0,(unsigned int)Env1,0.5,512); 
-          break;          
-     case 16:
-          CIllutronB::m_Voices[1].setup((unsigned int)RampTable,100.0,(unsigned int)Env1,0.5,512); 
-          break; 
-     } 
-     
-      
-      // if it gets to the end of our sequence, reset it and update the cycle counter
-      // the cycle counter is used below to change some of the voices
-       switch(play_track_now)
-        {
-          case 1:
-         if(nBeat == pCurrentSequence1->getLength())
-      {
-        nBeat=0;
-        nCycle++;
-        Serial.println(nCycle);
-        
-        if(nCycle >= 16)
-        {
-          nCycle = 0;
-        } 
-      }
-             break;
-          case 2:
-           if(nBeat == pCurrentSequence2->getLength())
+      // manual mode - the pot picks a sound, set it up once when it changes rather than on every beat. Sound 0 is
+      // song mode which starts the song again from the top, see Song.h
+      if(cycle_man != nSound)
       {
-        nBeat=0;
-        nCycle++;
-        if(nCycle >= 16)
+        nSound = cycle_man;
+        if(0 == nSound)
         {
-          nCycle = 0;
-        } 
-      }
-             break;
-          case 3:
-           if(nBeat == pCurrentSequence3->getLength())
-      {
-        nBeat=0;
-        nCycle++;
-        if(nCycle >= 16)
+          song.start(IllutronB);
+        }
+        else
         {
-          nCycle = 0;
-        } 
+          int8_t sSetup = getManualSetup(nSound);
+          if(sSetup >= 0)
+          {
+            applyVoiceSetup(IllutronB,sSetup);
+          }
+        }
       }
-             break;
-          case 4:
-         if(nBeat == pCurrentSequence4->getLength())
+
+      // if it gets to the end of our sequence, reset it and update the cycle counter
+      // in song mode the song counts the times round and changes the voices, and maybe the sequence, as it goes
+      if(nBeat == pCurrentSequence->getLength())
       {
         nBeat=0;
         nCycle++;
@@ -396,23 +273,12 @@ void loop()
         {
           nCycle = 0;
         }
-      }
-             break;
-        }
-  /*   
-     
-      if(nBeat == pCurrentSequence1->getLength())
-      {
-        nBeat=0;
-        nCycle++;
-        if(nCycle >= 16)
+        if((0 == nSound) && song.endOfSequence(IllutronB))
         {
-          nCycle = 0;
+          pCurrentSequence = song.getSequence(pButtonSequences[play_track_now-1]);
         }
       }
       
- */     
-      
       
     }
     
@@ -451,7 +317,7 @@ void updateVisualiser()
   {
     for(unsigned char sIndex = 0;sIndex < CHANNEL_MAX;sIndex++)
     {
-      sChannelPower[sIndex] = (CIllutronB::m_Voices[sIndex].getAmplitude() >> 4);
+      sChannelPower[sIndex] = (IllutronB.m_Voices[sIndex].getAmplitude() >> 4);
     }
     sRefreshDivider = REFRESH_DIVIDER;
   }
@@ -562,24 +428,28 @@ void BUTTONS() {
  if (mode_latch==1){  // Song select, pitch CANNEL_2:, pitch BPM  mode 
    if (button1==0){
      play_track_now=1;
+     pCurrentSequence=pButtonSequences[0];
      nBeat=0;
      pitch1=0;
      pitch2=0;
    }
    if (button2==0){
      play_track_now=2;
+     pCurrentSequence=pButtonSequences[1];
      nBeat=0;
      pitch1=0;
      pitch2=0;
    }
    if (button3==0){
      play_track_now=3;
+     pCurrentSequence=pButtonSequences[2];
      nBeat=0;
      pitch1=0;
      pitch2=0;
    }
    if (button4==0){
      play_track_now=4;
+     pCurrentSequence=pButtonSequences[3];
      nBeat=0;
      pitch1=0;
      pitch2=0;
@@ -0,0 +1,49 @@
+#ifndef _PRESETS_
+#define _PRESETS_
+
+// The voice presets - every sound the demo sketch uses, ready to pass to CVoice::setPreset. They are worked out when
+// the sketch is built so changing the sound of a voice as the song plays costs no more than triggering a note.
+// Add your own to the end and give them a name in the enum, the host tools also need the name in IllutronB_host.h.
+//
+// Include this after the wave tables and envelopes
+
+enum
+{
+  PRESET_DEMO_KICK = 0,     // the voices from setup() in the demo sketch
+  PRESET_DEMO_BASS,
+  PRESET_DEMO_SNARE,
+  PRESET_DEMO_HAT,
+  PRESET_TRIANGLE_HAT,      // the sounds used by the demo song and manual mode
+  PRESET_NOISE_HAT,
+  PRESET_TRIANGLE_LONG,
+  PRESET_TRIANGLE,
+  PRESET_TRIANGLE_SHORT,
+  PRESET_RAMP,
+  PRESET_NOISE_SHORT,
+  PRESET_SIN_LONG,
+  PRESET_NOISE,
+  PRESET_RAMP_LONG,
+  PRESET_SIN,
+  PRESET_COUNT
+};
+
+PROGMEM const SVoicePreset sPresets[PRESET_COUNT] =
+{
+  VOICE_PRESET(SinTable,200.0,Env0,0.4,300),
+  VOICE_PRESET(RampTable,100.0,Env1,1.0,512),
+  VOICE_PRESET(TriangleTable,100.0,Env2,.5,1000),
+  VOICE_PRESET(NoiseTable,1200.0,Env3,.04,500),
+  VOICE_PRESET(TriangleTable,1500.0,Env3,.03,100),
+  VOICE_PRESET(NoiseTable,1500.0,Env3,.03,300),
+  VOICE_PRESET(TriangleTable,100.0,Env1,0.6,512),
+  VOICE_PRESET(TriangleTable,100.0,Env1,0.5,512),
+  VOICE_PRESET(TriangleTable,100.0,Env1,0.4,512),
+  VOICE_PRESET(RampTable,100.0,Env1,0.5,512),
+  VOICE_PRESET(NoiseTable,100.0,Env1,0.1,512),
+  VOICE_PRESET(SinTable,100.0,Env1,1.0,512),
+  VOICE_PRESET(NoiseTable,100.0,Env1,0.8,512),
+  VOICE_PRESET(RampTable,100.0,Env1,0.8,512),
+  VOICE_PRESET(SinTable,100.0,Env1,0.8,512),
+};
+
+#endif
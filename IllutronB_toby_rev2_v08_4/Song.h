@@ -0,0 +1,178 @@
+#ifndef _SONG_
+#define _SONG_
+
+// Song mode - rather than play one sequence round and round with the same voices, a song is a list of entries
+// each of which plays a sequence a number of times and can change some of the voices before it starts. The voices
+// are only set up when an entry starts, not on every beat, and the whole song is in flash along with the voice presets.
+//
+// The sketch tells the song each time it gets to the end of the sequence, the song counts the repeats and when an
+// entry is finished moves on to the next one - back to the first after the last - and sets up the voices it changes.
+//
+// Include this after Presets.h and AmenBreak.h
+
+// One voice changing its sound, to one of the presets from Presets.h
+struct SVoiceSetup
+{
+  uint8_t sVoice;
+  uint8_t sPreset;
+};
+
+// Every voice change used by the songs and the sounds you can pick with the pot in manual mode, a song entry or a
+// sound uses one or more of these one after the other.
+PROGMEM const SVoiceSetup sVoiceSetups[] =
+{
+  // 0 - the demo song, the same changes the sketch has always made as it cycles through a sequence
+  {3,PRESET_TRIANGLE_HAT},
+  {1,PRESET_DEMO_BASS},
+  // 2
+  {3,PRESET_TRIANGLE_HAT},
+  // 3
+  {3,PRESET_NOISE_HAT},
+  // 4
+  {1,PRESET_TRIANGLE_LONG},
+  // 5
+  {1,PRESET_TRIANGLE},
+  // 6
+  {1,PRESET_TRIANGLE_SHORT},
+  // 7
+  {1,PRESET_RAMP},
+  // 8
+  {1,PRESET_DEMO_BASS},
+
+  // 9 - the sounds for manual mode, see getManualSetup
+  {1,PRESET_TRIANGLE},
+  {1,PRESET_NOISE_SHORT},
+  {1,PRESET_RAMP},
+  {1,PRESET_SIN_LONG},
+  {2,PRESET_TRIANGLE},
+  {2,PRESET_NOISE},
+  {2,PRESET_RAMP_LONG},
+  {2,PRESET_SIN},
+  {1,PRESET_TRIANGLE_LONG},
+  {1,PRESET_RAMP},
+};
+
+#define MANUAL_SETUP_START 9
+#define MANUAL_SETUP_FIRST_SOUND 2    // manual sounds 0 and 1 do not change anything - 0 is song mode
+#define MANUAL_SOUNDS 17
+
+// Manual mode picks a sound 2 to 16 with a pot, the later ones all used to be the same ramp so they share it here.
+// Returns the voice setup for the sound or -1 if the sound does not change anything.
+inline int8_t getManualSetup(uint8_t sSound)
+{
+  if((sSound < MANUAL_SETUP_FIRST_SOUND) || (sSound >= MANUAL_SOUNDS))
+  {
+    return -1;
+  }
+  uint8_t sSetup = sSound - MANUAL_SETUP_FIRST_SOUND;
+  if(sSetup > 9)
+  {
+    sSetup = 9;
+  }
+  return MANUAL_SETUP_START + sSetup;
+}
+
+// Send a voice its new preset
+inline void applyVoiceSetup(CIllutronB &synth,uint8_t sSetup)
+{
+  uint8_t sVoice = pgm_read_byte(&sVoiceSetups[sSetup].sVoice);
+  uint8_t sPreset = pgm_read_byte(&sVoiceSetups[sSetup].sPreset);
+  synth.m_Voices[sVoice].setPreset(&sPresets[sPreset]);
+}
+
+// play whichever sequence was chosen with the buttons rather than a particular one
+#define SONG_BUTTON_SEQUENCE 0xFF
+
+// One entry of a song
+struct SSongEntry
+{
+  uint8_t sSequence;      // the sequence to play, an index into pButtonSequences or SONG_BUTTON_SEQUENCE
+  uint8_t sRepeats;       // how many times to play it
+  uint8_t sFirstSetup;    // the first of the voice setups to make when the entry starts, from sVoiceSetups
+  uint8_t sSetups;        // and how many, 0 to leave the voices alone
+};
+
+// The demo song - sixteen times through whichever sequence is playing, changing the sound as it goes
+PROGMEM const SSongEntry demoSong[] =
+{
+  {SONG_BUTTON_SEQUENCE,4,0,0},
+  {SONG_BUTTON_SEQUENCE,2,0,2},
+  {SONG_BUTTON_SEQUENCE,2,2,1},
+  {SONG_BUTTON_SEQUENCE,2,3,1},
+  {SONG_BUTTON_SEQUENCE,1,4,1},
+  {SONG_BUTTON_SEQUENCE,1,5,1},
+  {SONG_BUTTON_SEQUENCE,2,6,1},
+  {SONG_BUTTON_SEQUENCE,1,7,1},
+  {SONG_BUTTON_SEQUENCE,1,8,1},
+};
+
+class CSong
+{
+  public:
+    CSong(const SSongEntry *pEntries,uint8_t sEntries)
+    {
+      m_pEntries = pEntries;
+      m_sEntries = sEntries;
+      m_sEntry = 0;
+      m_sRepeat = 0;
+    }
+
+    // back to the start of the song, setting up the voices for the first entry
+    void start(CIllutronB &synth)
+    {
+      m_sEntry = 0;
+      m_sRepeat = 0;
+      startEntry(synth);
+    }
+
+    // call this each time the sequence gets back to its first step, returns true if the song has moved on to a
+    // new entry - which might want a different sequence, see getSequence
+    bool endOfSequence(CIllutronB &synth)
+    {
+      m_sRepeat++;
+      if(m_sRepeat < pgm_read_byte(&m_pEntries[m_sEntry].sRepeats))
+      {
+        return false;
+      }
+      m_sRepeat = 0;
+      m_sEntry++;
+      if(m_sEntry >= m_sEntries)
+      {
+        m_sEntry = 0;
+      }
+      startEntry(synth);
+      return true;
+    }
+
+    // the sequence for the current entry, pButtonSequence if the entry plays whatever the buttons chose
+    CFlashSequence *getSequence(CFlashSequence *pButtonSequence)
+    {
+      uint8_t sSequence = pgm_read_byte(&m_pEntries[m_sEntry].sSequence);
+      return (sSequence < SEQUENCE_BUTTONS) ? pButtonSequences[sSequence] : pButtonSequence;
+    }
+
+    uint8_t getEntry()
+    {
+      return m_sEntry;
+    }
+
+  protected:
+    void startEntry(CIllutronB &synth)
+    {
+      uint8_t sSetup = pgm_read_byte(&m_pEntries[m_sEntry].sFirstSetup);
+      uint8_t sSetups = pgm_read_byte(&m_pEntries[m_sEntry].sSetups);
+      while(sSetups--)
+      {
+        applyVoiceSetup(synth,sSetup++);
+      }
+    }
+
+    const SSongEntry *m_pEntries;
+    uint8_t m_sEntries;
+    uint8_t m_sEntry;     // the entry we are playing
+    uint8_t m_sRepeat;    // and how many times we have played its sequence
+};
+
+CSong song(demoSong,sizeof(demoSong)/sizeof(demoSong[0]));
+
+#endif
@@ -1,7 +1,7 @@
 #ifndef _ENVELOPE0_
 #define _ENVELOPE0_
 
-PROGMEM char Env0[]=
+PROGMEM const unsigned char Env0[]=
 {
 	255,	//0
 	254,	//1
@@ -261,7 +261,7 @@ PROGMEM char Env0[]=
 	0,	//255
 };
 
-PROGMEM char Inv0[]=
+PROGMEM const unsigned char Inv0[]=
 {
 0,  // 0
 0,  // 1
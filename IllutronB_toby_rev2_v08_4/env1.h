@@ -1,7 +1,7 @@
 #ifndef _ENVELOPE1_
 #define _ENVELOPE1_
 
-PROGMEM char Env1[]=
+PROGMEM const unsigned char Env1[]=
 {
 	255,	//0
 	248,	//1
@@ -261,7 +261,7 @@ PROGMEM char Env1[]=
 	0,	//255
 };
 
-PROGMEM char Inv1[]=
+PROGMEM const unsigned char Inv1[]=
 {
   0,  // 0
   0,  // 1
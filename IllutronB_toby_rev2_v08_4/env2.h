@@ -1,7 +1,7 @@
 #ifndef _ENVELOPE2_
 #define _ENVELOPE2_
 
-PROGMEM char Env2[]=
+PROGMEM const unsigned char Env2[]=
 {
 	255,	//0
 	254,	//1
@@ -261,7 +261,7 @@ PROGMEM char Env2[]=
 	0,	//255
 };
 
-PROGMEM char Inv2[]=
+PROGMEM const unsigned char Inv2[]=
 {
 0,  // 0
 0,  // 1
@@ -1,7 +1,7 @@
 #ifndef _ENVELOPE3_
 #define _ENVELOPE3_
 
-PROGMEM char Env3[]=
+PROGMEM const unsigned char Env3[]=
 {
 	255,	//0
 	252,	//1
@@ -261,7 +261,7 @@ PROGMEM char Env3[]=
 	0,	//255
 };
 
-PROGMEM char Inv3[]=
+PROGMEM const unsigned char Inv3[]=
 {
 0,  // 0
 0,  // 1
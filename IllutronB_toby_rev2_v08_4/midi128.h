@@ -0,0 +1,142 @@
+#ifndef _MIDI_PITCH_
+#define _MIDI_PITCH_
+
+// Wave phase increments for midi notes 0 to 127 - used by CIllutronB::CVoice::triggerMidi
+// This used to be calculated in initSynth using 128 calls to exp, its now calculated once and kept in flash
+// with the wave tables, saving the 256 bytes of RAM and the start up time.
+// Each entry is (440 * exp(.057762265 * (note - 69))) / (SAMPLE_RATE / 65535.0) - 440Hz is A4, midi note 69
+// The values are the same whether the formula is calculated at float or double precision.
+
+PROGMEM const uint16_t MidiPitchTable[]=
+{
+	33,	//0
+	35,	//1
+	37,	//2
+	39,	//3
+	42,	//4
+	44,	//5
+	47,	//6
+	50,	//7
+	53,	//8
+	56,	//9
+	59,	//10
+	63,	//11
+	66,	//12
+	70,	//13
+	75,	//14
+	79,	//15
+	84,	//16
+	89,	//17
+	94,	//18
+	100,	//19
+	106,	//20
+	112,	//21
+	119,	//22
+	126,	//23
+	133,	//24
+	141,	//25
+	150,	//26
+	159,	//27
+	168,	//28
+	178,	//29
+	189,	//30
+	200,	//31
+	212,	//32
+	225,	//33
+	238,	//34
+	252,	//35
+	267,	//36
+	283,	//37
+	300,	//38
+	318,	//39
+	337,	//40
+	357,	//41
+	378,	//42
+	401,	//43
+	425,	//44
+	450,	//45
+	477,	//46
+	505,	//47
+	535,	//48
+	567,	//49
+	601,	//50
+	637,	//51
+	675,	//52
+	715,	//53
+	757,	//54
+	802,	//55
+	850,	//56
+	901,	//57
+	954,	//58
+	1011,	//59
+	1071,	//60
+	1135,	//61
+	1202,	//62
+	1274,	//63
+	1350,	//64
+	1430,	//65
+	1515,	//66
+	1605,	//67
+	1701,	//68
+	1802,	//69
+	1909,	//70
+	2022,	//71
+	2143,	//72
+	2270,	//73
+	2405,	//74
+	2548,	//75
+	2700,	//76
+	2860,	//77
+	3030,	//78
+	3211,	//79
+	3402,	//80
+	3604,	//81
+	3818,	//82
+	4045,	//83
+	4286,	//84
+	4541,	//85
+	4811,	//86
+	5097,	//87
+	5400,	//88
+	5721,	//89
+	6061,	//90
+	6422,	//91
+	6804,	//92
+	7208,	//93
+	7637,	//94
+	8091,	//95
+	8572,	//96
+	9082,	//97
+	9622,	//98
+	10194,	//99
+	10801,	//100
+	11443,	//101
+	12123,	//102
+	12844,	//103
+	13608,	//104
+	14417,	//105
+	15275,	//106
+	16183,	//107
+	17145,	//108
+	18165,	//109
+	19245,	//110
+	20389,	//111
+	21602,	//112
+	22886,	//113
+	24247,	//114
+	25689,	//115
+	27216,	//116
+	28835,	//117
+	30550,	//118
+	32366,	//119
+	34291,	//120
+	36330,	//121
+	38490,	//122
+	40779,	//123
+	43204,	//124
+	45773,	//125
+	48495,	//126
+	51378,	//127
+};
+
+#endif
@@ -1,7 +1,7 @@
 #ifndef _NOISE_
 #define _NOISE_
 
-PROGMEM char NoiseTable[]=
+PROGMEM const signed char NoiseTable[]=
 {
 	-62,	//0
 	-72,	//1
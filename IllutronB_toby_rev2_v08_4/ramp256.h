@@ -1,7 +1,7 @@
 #ifndef _RAMP_
 #define _RAMP_
 
-PROGMEM char RampTable[]=
+PROGMEM const signed char RampTable[]=
 {
 	-127,	//0
 	-126,	//1
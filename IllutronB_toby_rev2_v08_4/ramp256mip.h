@@ -0,0 +1,2068 @@
+#ifndef _RAMP_MIPMAP_
+#define _RAMP_MIPMAP_
+
+// Band limited versions of RampTable for CVoice::setMipmap - made by IllutronB_host/IllutronB_mipmap, do not edit.
+// 8 tables of 256 entries one after the other, level n has the first 128>>n harmonics of RampTable and
+// is played for notes with a wave phase increment up to 256<<n, any higher and its top harmonic would alias.
+
+PROGMEM const signed char RampMipmap[]=
+{
+	// level 0 - 128 harmonics
+	-110,	//0
+	-110,	//1
+	-109,	//2
+	-108,	//3
+	-107,	//4
+	-106,	//5
+	-105,	//6
+	-104,	//7
+	-104,	//8
+	-103,	//9
+	-102,	//10
+	-101,	//11
+	-100,	//12
+	-99,	//13
+	-98,	//14
+	-97,	//15
+	-97,	//16
+	-96,	//17
+	-95,	//18
+	-94,	//19
+	-93,	//20
+	-92,	//21
+	-91,	//22
+	-90,	//23
+	-90,	//24
+	-89,	//25
+	-88,	//26
+	-87,	//27
+	-86,	//28
+	-85,	//29
+	-84,	//30
+	-84,	//31
+	-83,	//32
+	-82,	//33
+	-81,	//34
+	-80,	//35
+	-79,	//36
+	-78,	//37
+	-77,	//38
+	-77,	//39
+	-76,	//40
+	-75,	//41
+	-74,	//42
+	-73,	//43
+	-72,	//44
+	-71,	//45
+	-70,	//46
+	-70,	//47
+	-69,	//48
+	-68,	//49
+	-67,	//50
+	-66,	//51
+	-65,	//52
+	-64,	//53
+	-64,	//54
+	-63,	//55
+	-62,	//56
+	-61,	//57
+	-60,	//58
+	-59,	//59
+	-58,	//60
+	-57,	//61
+	-57,	//62
+	-56,	//63
+	-55,	//64
+	-54,	//65
+	-53,	//66
+	-52,	//67
+	-51,	//68
+	-50,	//69
+	-50,	//70
+	-49,	//71
+	-48,	//72
+	-47,	//73
+	-46,	//74
+	-45,	//75
+	-44,	//76
+	-44,	//77
+	-43,	//78
+	-42,	//79
+	-41,	//80
+	-40,	//81
+	-39,	//82
+	-38,	//83
+	-37,	//84
+	-37,	//85
+	-36,	//86
+	-35,	//87
+	-34,	//88
+	-33,	//89
+	-32,	//90
+	-31,	//91
+	-30,	//92
+	-30,	//93
+	-29,	//94
+	-28,	//95
+	-27,	//96
+	-26,	//97
+	-25,	//98
+	-24,	//99
+	-23,	//100
+	-23,	//101
+	-22,	//102
+	-21,	//103
+	-20,	//104
+	-19,	//105
+	-18,	//106
+	-17,	//107
+	-17,	//108
+	-16,	//109
+	-15,	//110
+	-14,	//111
+	-13,	//112
+	-12,	//113
+	-11,	//114
+	-10,	//115
+	-10,	//116
+	-9,	//117
+	-8,	//118
+	-7,	//119
+	-6,	//120
+	-5,	//121
+	-4,	//122
+	-3,	//123
+	-3,	//124
+	-2,	//125
+	-1,	//126
+	0,	//127
+	0,	//128
+	1,	//129
+	2,	//130
+	3,	//131
+	3,	//132
+	4,	//133
+	5,	//134
+	6,	//135
+	7,	//136
+	8,	//137
+	9,	//138
+	10,	//139
+	10,	//140
+	11,	//141
+	12,	//142
+	13,	//143
+	14,	//144
+	15,	//145
+	16,	//146
+	17,	//147
+	17,	//148
+	18,	//149
+	19,	//150
+	20,	//151
+	21,	//152
+	22,	//153
+	23,	//154
+	23,	//155
+	24,	//156
+	25,	//157
+	26,	//158
+	27,	//159
+	28,	//160
+	29,	//161
+	30,	//162
+	30,	//163
+	31,	//164
+	32,	//165
+	33,	//166
+	34,	//167
+	35,	//168
+	36,	//169
+	37,	//170
+	37,	//171
+	38,	//172
+	39,	//173
+	40,	//174
+	41,	//175
+	42,	//176
+	43,	//177
+	44,	//178
+	44,	//179
+	45,	//180
+	46,	//181
+	47,	//182
+	48,	//183
+	49,	//184
+	50,	//185
+	50,	//186
+	51,	//187
+	52,	//188
+	53,	//189
+	54,	//190
+	55,	//191
+	56,	//192
+	57,	//193
+	57,	//194
+	58,	//195
+	59,	//196
+	60,	//197
+	61,	//198
+	62,	//199
+	63,	//200
+	64,	//201
+	64,	//202
+	65,	//203
+	66,	//204
+	67,	//205
+	68,	//206
+	69,	//207
+	70,	//208
+	70,	//209
+	71,	//210
+	72,	//211
+	73,	//212
+	74,	//213
+	75,	//214
+	76,	//215
+	77,	//216
+	77,	//217
+	78,	//218
+	79,	//219
+	80,	//220
+	81,	//221
+	82,	//222
+	83,	//223
+	84,	//224
+	84,	//225
+	85,	//226
+	86,	//227
+	87,	//228
+	88,	//229
+	89,	//230
+	90,	//231
+	90,	//232
+	91,	//233
+	92,	//234
+	93,	//235
+	94,	//236
+	95,	//237
+	96,	//238
+	97,	//239
+	97,	//240
+	98,	//241
+	99,	//242
+	100,	//243
+	101,	//244
+	102,	//245
+	103,	//246
+	104,	//247
+	104,	//248
+	105,	//249
+	106,	//250
+	107,	//251
+	108,	//252
+	109,	//253
+	110,	//254
+	110,	//255
+	// level 1 - 64 harmonics
+	-55,	//256
+	-125,	//257
+	-123,	//258
+	-99,	//259
+	-99,	//260
+	-112,	//261
+	-111,	//262
+	-100,	//263
+	-100,	//264
+	-107,	//265
+	-105,	//266
+	-98,	//267
+	-98,	//268
+	-102,	//269
+	-100,	//270
+	-95,	//271
+	-95,	//272
+	-98,	//273
+	-96,	//274
+	-92,	//275
+	-92,	//276
+	-94,	//277
+	-92,	//278
+	-89,	//279
+	-89,	//280
+	-90,	//281
+	-89,	//282
+	-85,	//283
+	-85,	//284
+	-87,	//285
+	-85,	//286
+	-82,	//287
+	-82,	//288
+	-83,	//289
+	-81,	//290
+	-79,	//291
+	-79,	//292
+	-80,	//293
+	-78,	//294
+	-75,	//295
+	-75,	//296
+	-76,	//297
+	-74,	//298
+	-72,	//299
+	-72,	//300
+	-72,	//301
+	-71,	//302
+	-69,	//303
+	-69,	//304
+	-69,	//305
+	-67,	//306
+	-65,	//307
+	-65,	//308
+	-65,	//309
+	-64,	//310
+	-62,	//311
+	-62,	//312
+	-62,	//313
+	-60,	//314
+	-58,	//315
+	-58,	//316
+	-58,	//317
+	-57,	//318
+	-55,	//319
+	-55,	//320
+	-55,	//321
+	-53,	//322
+	-51,	//323
+	-51,	//324
+	-51,	//325
+	-50,	//326
+	-48,	//327
+	-48,	//328
+	-48,	//329
+	-46,	//330
+	-44,	//331
+	-44,	//332
+	-44,	//333
+	-43,	//334
+	-41,	//335
+	-41,	//336
+	-41,	//337
+	-39,	//338
+	-38,	//339
+	-38,	//340
+	-37,	//341
+	-35,	//342
+	-34,	//343
+	-34,	//344
+	-34,	//345
+	-32,	//346
+	-31,	//347
+	-31,	//348
+	-30,	//349
+	-28,	//350
+	-27,	//351
+	-27,	//352
+	-27,	//353
+	-25,	//354
+	-24,	//355
+	-24,	//356
+	-23,	//357
+	-21,	//358
+	-20,	//359
+	-20,	//360
+	-20,	//361
+	-18,	//362
+	-17,	//363
+	-17,	//364
+	-16,	//365
+	-14,	//366
+	-13,	//367
+	-13,	//368
+	-13,	//369
+	-11,	//370
+	-10,	//371
+	-10,	//372
+	-9,	//373
+	-7,	//374
+	-6,	//375
+	-6,	//376
+	-6,	//377
+	-4,	//378
+	-3,	//379
+	-3,	//380
+	-2,	//381
+	0,	//382
+	0,	//383
+	0,	//384
+	0,	//385
+	2,	//386
+	3,	//387
+	3,	//388
+	4,	//389
+	6,	//390
+	6,	//391
+	6,	//392
+	7,	//393
+	9,	//394
+	10,	//395
+	10,	//396
+	11,	//397
+	13,	//398
+	13,	//399
+	13,	//400
+	14,	//401
+	16,	//402
+	17,	//403
+	17,	//404
+	18,	//405
+	20,	//406
+	20,	//407
+	20,	//408
+	21,	//409
+	23,	//410
+	24,	//411
+	24,	//412
+	25,	//413
+	27,	//414
+	27,	//415
+	27,	//416
+	28,	//417
+	30,	//418
+	31,	//419
+	31,	//420
+	32,	//421
+	34,	//422
+	34,	//423
+	34,	//424
+	35,	//425
+	37,	//426
+	38,	//427
+	38,	//428
+	39,	//429
+	41,	//430
+	41,	//431
+	41,	//432
+	43,	//433
+	44,	//434
+	44,	//435
+	44,	//436
+	46,	//437
+	48,	//438
+	48,	//439
+	48,	//440
+	50,	//441
+	51,	//442
+	51,	//443
+	51,	//444
+	53,	//445
+	55,	//446
+	55,	//447
+	55,	//448
+	57,	//449
+	58,	//450
+	58,	//451
+	58,	//452
+	60,	//453
+	62,	//454
+	62,	//455
+	62,	//456
+	64,	//457
+	65,	//458
+	65,	//459
+	65,	//460
+	67,	//461
+	69,	//462
+	69,	//463
+	69,	//464
+	71,	//465
+	72,	//466
+	72,	//467
+	72,	//468
+	74,	//469
+	76,	//470
+	75,	//471
+	75,	//472
+	78,	//473
+	80,	//474
+	79,	//475
+	79,	//476
+	81,	//477
+	83,	//478
+	82,	//479
+	82,	//480
+	85,	//481
+	87,	//482
+	85,	//483
+	85,	//484
+	89,	//485
+	90,	//486
+	89,	//487
+	89,	//488
+	92,	//489
+	94,	//490
+	92,	//491
+	92,	//492
+	96,	//493
+	98,	//494
+	95,	//495
+	95,	//496
+	100,	//497
+	102,	//498
+	98,	//499
+	98,	//500
+	105,	//501
+	107,	//502
+	100,	//503
+	100,	//504
+	111,	//505
+	112,	//506
+	99,	//507
+	99,	//508
+	123,	//509
+	125,	//510
+	55,	//511
+	// level 2 - 32 harmonics
+	-28,	//512
+	-77,	//513
+	-112,	//514
+	-127,	//515
+	-125,	//516
+	-114,	//517
+	-101,	//518
+	-94,	//519
+	-94,	//520
+	-99,	//521
+	-105,	//522
+	-108,	//523
+	-107,	//524
+	-101,	//525
+	-95,	//526
+	-92,	//527
+	-92,	//528
+	-94,	//529
+	-97,	//530
+	-99,	//531
+	-97,	//532
+	-93,	//533
+	-89,	//534
+	-87,	//535
+	-87,	//536
+	-88,	//537
+	-90,	//538
+	-90,	//539
+	-89,	//540
+	-85,	//541
+	-82,	//542
+	-81,	//543
+	-81,	//544
+	-82,	//545
+	-83,	//546
+	-83,	//547
+	-81,	//548
+	-78,	//549
+	-76,	//550
+	-74,	//551
+	-74,	//552
+	-75,	//553
+	-76,	//554
+	-75,	//555
+	-74,	//556
+	-71,	//557
+	-69,	//558
+	-68,	//559
+	-68,	//560
+	-68,	//561
+	-69,	//562
+	-68,	//563
+	-66,	//564
+	-64,	//565
+	-62,	//566
+	-61,	//567
+	-61,	//568
+	-61,	//569
+	-62,	//570
+	-61,	//571
+	-59,	//572
+	-57,	//573
+	-55,	//574
+	-54,	//575
+	-54,	//576
+	-55,	//577
+	-55,	//578
+	-54,	//579
+	-52,	//580
+	-50,	//581
+	-48,	//582
+	-47,	//583
+	-47,	//584
+	-48,	//585
+	-47,	//586
+	-46,	//587
+	-45,	//588
+	-43,	//589
+	-41,	//590
+	-41,	//591
+	-41,	//592
+	-41,	//593
+	-40,	//594
+	-39,	//595
+	-38,	//596
+	-36,	//597
+	-34,	//598
+	-34,	//599
+	-34,	//600
+	-34,	//601
+	-33,	//602
+	-32,	//603
+	-31,	//604
+	-29,	//605
+	-27,	//606
+	-27,	//607
+	-27,	//608
+	-27,	//609
+	-26,	//610
+	-25,	//611
+	-23,	//612
+	-22,	//613
+	-21,	//614
+	-20,	//615
+	-20,	//616
+	-20,	//617
+	-19,	//618
+	-18,	//619
+	-16,	//620
+	-15,	//621
+	-14,	//622
+	-13,	//623
+	-13,	//624
+	-13,	//625
+	-12,	//626
+	-11,	//627
+	-9,	//628
+	-8,	//629
+	-7,	//630
+	-6,	//631
+	-6,	//632
+	-6,	//633
+	-5,	//634
+	-4,	//635
+	-2,	//636
+	-1,	//637
+	0,	//638
+	0,	//639
+	0,	//640
+	0,	//641
+	1,	//642
+	2,	//643
+	4,	//644
+	5,	//645
+	6,	//646
+	6,	//647
+	6,	//648
+	7,	//649
+	8,	//650
+	9,	//651
+	11,	//652
+	12,	//653
+	13,	//654
+	13,	//655
+	13,	//656
+	14,	//657
+	15,	//658
+	16,	//659
+	18,	//660
+	19,	//661
+	20,	//662
+	20,	//663
+	20,	//664
+	21,	//665
+	22,	//666
+	23,	//667
+	25,	//668
+	26,	//669
+	27,	//670
+	27,	//671
+	27,	//672
+	27,	//673
+	29,	//674
+	31,	//675
+	32,	//676
+	33,	//677
+	34,	//678
+	34,	//679
+	34,	//680
+	34,	//681
+	36,	//682
+	38,	//683
+	39,	//684
+	40,	//685
+	41,	//686
+	41,	//687
+	41,	//688
+	41,	//689
+	43,	//690
+	45,	//691
+	46,	//692
+	47,	//693
+	48,	//694
+	47,	//695
+	47,	//696
+	48,	//697
+	50,	//698
+	52,	//699
+	54,	//700
+	55,	//701
+	55,	//702
+	54,	//703
+	54,	//704
+	55,	//705
+	57,	//706
+	59,	//707
+	61,	//708
+	62,	//709
+	61,	//710
+	61,	//711
+	61,	//712
+	62,	//713
+	64,	//714
+	66,	//715
+	68,	//716
+	69,	//717
+	68,	//718
+	68,	//719
+	68,	//720
+	69,	//721
+	71,	//722
+	74,	//723
+	75,	//724
+	76,	//725
+	75,	//726
+	74,	//727
+	74,	//728
+	76,	//729
+	78,	//730
+	81,	//731
+	83,	//732
+	83,	//733
+	82,	//734
+	81,	//735
+	81,	//736
+	82,	//737
+	85,	//738
+	89,	//739
+	90,	//740
+	90,	//741
+	88,	//742
+	87,	//743
+	87,	//744
+	89,	//745
+	93,	//746
+	97,	//747
+	99,	//748
+	97,	//749
+	94,	//750
+	92,	//751
+	92,	//752
+	95,	//753
+	101,	//754
+	107,	//755
+	108,	//756
+	105,	//757
+	99,	//758
+	94,	//759
+	94,	//760
+	101,	//761
+	114,	//762
+	125,	//763
+	127,	//764
+	112,	//765
+	77,	//766
+	28,	//767
+	// level 3 - 16 harmonics
+	-14,	//768
+	-41,	//769
+	-66,	//770
+	-87,	//771
+	-104,	//772
+	-115,	//773
+	-122,	//774
+	-124,	//775
+	-123,	//776
+	-118,	//777
+	-111,	//778
+	-104,	//779
+	-98,	//780
+	-92,	//781
+	-88,	//782
+	-87,	//783
+	-87,	//784
+	-88,	//785
+	-90,	//786
+	-93,	//787
+	-96,	//788
+	-98,	//789
+	-98,	//790
+	-98,	//791
+	-96,	//792
+	-93,	//793
+	-90,	//794
+	-87,	//795
+	-83,	//796
+	-81,	//797
+	-79,	//798
+	-78,	//799
+	-78,	//800
+	-79,	//801
+	-80,	//802
+	-81,	//803
+	-82,	//804
+	-82,	//805
+	-82,	//806
+	-81,	//807
+	-79,	//808
+	-77,	//809
+	-74,	//810
+	-72,	//811
+	-70,	//812
+	-68,	//813
+	-67,	//814
+	-66,	//815
+	-66,	//816
+	-66,	//817
+	-67,	//818
+	-68,	//819
+	-68,	//820
+	-68,	//821
+	-67,	//822
+	-66,	//823
+	-64,	//824
+	-62,	//825
+	-60,	//826
+	-58,	//827
+	-56,	//828
+	-54,	//829
+	-53,	//830
+	-53,	//831
+	-53,	//832
+	-53,	//833
+	-54,	//834
+	-54,	//835
+	-54,	//836
+	-53,	//837
+	-52,	//838
+	-51,	//839
+	-49,	//840
+	-47,	//841
+	-45,	//842
+	-43,	//843
+	-42,	//844
+	-41,	//845
+	-40,	//846
+	-40,	//847
+	-40,	//848
+	-40,	//849
+	-40,	//850
+	-40,	//851
+	-40,	//852
+	-39,	//853
+	-38,	//854
+	-36,	//855
+	-35,	//856
+	-33,	//857
+	-31,	//858
+	-29,	//859
+	-28,	//860
+	-27,	//861
+	-27,	//862
+	-27,	//863
+	-27,	//864
+	-27,	//865
+	-27,	//866
+	-26,	//867
+	-26,	//868
+	-25,	//869
+	-24,	//870
+	-22,	//871
+	-20,	//872
+	-18,	//873
+	-17,	//874
+	-15,	//875
+	-14,	//876
+	-14,	//877
+	-13,	//878
+	-13,	//879
+	-13,	//880
+	-13,	//881
+	-13,	//882
+	-12,	//883
+	-12,	//884
+	-11,	//885
+	-9,	//886
+	-8,	//887
+	-6,	//888
+	-4,	//889
+	-3,	//890
+	-1,	//891
+	-1,	//892
+	0,	//893
+	0,	//894
+	0,	//895
+	0,	//896
+	0,	//897
+	0,	//898
+	1,	//899
+	1,	//900
+	3,	//901
+	4,	//902
+	6,	//903
+	8,	//904
+	9,	//905
+	11,	//906
+	12,	//907
+	12,	//908
+	13,	//909
+	13,	//910
+	13,	//911
+	13,	//912
+	13,	//913
+	14,	//914
+	14,	//915
+	15,	//916
+	17,	//917
+	18,	//918
+	20,	//919
+	22,	//920
+	24,	//921
+	25,	//922
+	26,	//923
+	26,	//924
+	27,	//925
+	27,	//926
+	27,	//927
+	27,	//928
+	27,	//929
+	27,	//930
+	28,	//931
+	29,	//932
+	31,	//933
+	33,	//934
+	35,	//935
+	36,	//936
+	38,	//937
+	39,	//938
+	40,	//939
+	40,	//940
+	40,	//941
+	40,	//942
+	40,	//943
+	40,	//944
+	40,	//945
+	41,	//946
+	42,	//947
+	43,	//948
+	45,	//949
+	47,	//950
+	49,	//951
+	51,	//952
+	52,	//953
+	53,	//954
+	54,	//955
+	54,	//956
+	54,	//957
+	53,	//958
+	53,	//959
+	53,	//960
+	53,	//961
+	54,	//962
+	56,	//963
+	58,	//964
+	60,	//965
+	62,	//966
+	64,	//967
+	66,	//968
+	67,	//969
+	68,	//970
+	68,	//971
+	68,	//972
+	67,	//973
+	66,	//974
+	66,	//975
+	66,	//976
+	67,	//977
+	68,	//978
+	70,	//979
+	72,	//980
+	74,	//981
+	77,	//982
+	79,	//983
+	81,	//984
+	82,	//985
+	82,	//986
+	82,	//987
+	81,	//988
+	80,	//989
+	79,	//990
+	78,	//991
+	78,	//992
+	79,	//993
+	81,	//994
+	83,	//995
+	87,	//996
+	90,	//997
+	93,	//998
+	96,	//999
+	98,	//1000
+	98,	//1001
+	98,	//1002
+	96,	//1003
+	93,	//1004
+	90,	//1005
+	88,	//1006
+	87,	//1007
+	87,	//1008
+	88,	//1009
+	92,	//1010
+	98,	//1011
+	104,	//1012
+	111,	//1013
+	118,	//1014
+	123,	//1015
+	124,	//1016
+	122,	//1017
+	115,	//1018
+	104,	//1019
+	87,	//1020
+	66,	//1021
+	41,	//1022
+	14,	//1023
+	// level 4 - 8 harmonics
+	-7,	//1024
+	-21,	//1025
+	-34,	//1026
+	-47,	//1027
+	-59,	//1028
+	-71,	//1029
+	-81,	//1030
+	-90,	//1031
+	-98,	//1032
+	-105,	//1033
+	-110,	//1034
+	-114,	//1035
+	-117,	//1036
+	-118,	//1037
+	-118,	//1038
+	-117,	//1039
+	-116,	//1040
+	-113,	//1041
+	-110,	//1042
+	-106,	//1043
+	-102,	//1044
+	-98,	//1045
+	-94,	//1046
+	-90,	//1047
+	-87,	//1048
+	-83,	//1049
+	-80,	//1050
+	-78,	//1051
+	-76,	//1052
+	-74,	//1053
+	-73,	//1054
+	-73,	//1055
+	-73,	//1056
+	-73,	//1057
+	-74,	//1058
+	-75,	//1059
+	-76,	//1060
+	-77,	//1061
+	-78,	//1062
+	-79,	//1063
+	-80,	//1064
+	-80,	//1065
+	-80,	//1066
+	-80,	//1067
+	-80,	//1068
+	-79,	//1069
+	-78,	//1070
+	-76,	//1071
+	-75,	//1072
+	-73,	//1073
+	-71,	//1074
+	-68,	//1075
+	-66,	//1076
+	-64,	//1077
+	-62,	//1078
+	-59,	//1079
+	-57,	//1080
+	-56,	//1081
+	-54,	//1082
+	-53,	//1083
+	-52,	//1084
+	-52,	//1085
+	-51,	//1086
+	-51,	//1087
+	-51,	//1088
+	-51,	//1089
+	-51,	//1090
+	-52,	//1091
+	-52,	//1092
+	-52,	//1093
+	-52,	//1094
+	-52,	//1095
+	-52,	//1096
+	-52,	//1097
+	-51,	//1098
+	-50,	//1099
+	-49,	//1100
+	-48,	//1101
+	-47,	//1102
+	-45,	//1103
+	-43,	//1104
+	-42,	//1105
+	-40,	//1106
+	-38,	//1107
+	-36,	//1108
+	-34,	//1109
+	-32,	//1110
+	-31,	//1111
+	-30,	//1112
+	-29,	//1113
+	-28,	//1114
+	-27,	//1115
+	-26,	//1116
+	-26,	//1117
+	-26,	//1118
+	-26,	//1119
+	-26,	//1120
+	-26,	//1121
+	-26,	//1122
+	-26,	//1123
+	-26,	//1124
+	-26,	//1125
+	-25,	//1126
+	-25,	//1127
+	-24,	//1128
+	-23,	//1129
+	-22,	//1130
+	-21,	//1131
+	-20,	//1132
+	-18,	//1133
+	-17,	//1134
+	-15,	//1135
+	-13,	//1136
+	-12,	//1137
+	-10,	//1138
+	-8,	//1139
+	-7,	//1140
+	-5,	//1141
+	-4,	//1142
+	-3,	//1143
+	-2,	//1144
+	-1,	//1145
+	-1,	//1146
+	0,	//1147
+	0,	//1148
+	0,	//1149
+	0,	//1150
+	0,	//1151
+	0,	//1152
+	0,	//1153
+	0,	//1154
+	0,	//1155
+	0,	//1156
+	1,	//1157
+	1,	//1158
+	2,	//1159
+	3,	//1160
+	4,	//1161
+	5,	//1162
+	7,	//1163
+	8,	//1164
+	10,	//1165
+	12,	//1166
+	13,	//1167
+	15,	//1168
+	17,	//1169
+	18,	//1170
+	20,	//1171
+	21,	//1172
+	22,	//1173
+	23,	//1174
+	24,	//1175
+	25,	//1176
+	25,	//1177
+	26,	//1178
+	26,	//1179
+	26,	//1180
+	26,	//1181
+	26,	//1182
+	26,	//1183
+	26,	//1184
+	26,	//1185
+	26,	//1186
+	26,	//1187
+	27,	//1188
+	28,	//1189
+	29,	//1190
+	30,	//1191
+	31,	//1192
+	32,	//1193
+	34,	//1194
+	36,	//1195
+	38,	//1196
+	40,	//1197
+	42,	//1198
+	43,	//1199
+	45,	//1200
+	47,	//1201
+	48,	//1202
+	49,	//1203
+	50,	//1204
+	51,	//1205
+	52,	//1206
+	52,	//1207
+	52,	//1208
+	52,	//1209
+	52,	//1210
+	52,	//1211
+	52,	//1212
+	51,	//1213
+	51,	//1214
+	51,	//1215
+	51,	//1216
+	51,	//1217
+	52,	//1218
+	52,	//1219
+	53,	//1220
+	54,	//1221
+	56,	//1222
+	57,	//1223
+	59,	//1224
+	62,	//1225
+	64,	//1226
+	66,	//1227
+	68,	//1228
+	71,	//1229
+	73,	//1230
+	75,	//1231
+	76,	//1232
+	78,	//1233
+	79,	//1234
+	80,	//1235
+	80,	//1236
+	80,	//1237
+	80,	//1238
+	80,	//1239
+	79,	//1240
+	78,	//1241
+	77,	//1242
+	76,	//1243
+	75,	//1244
+	74,	//1245
+	73,	//1246
+	73,	//1247
+	73,	//1248
+	73,	//1249
+	74,	//1250
+	76,	//1251
+	78,	//1252
+	80,	//1253
+	83,	//1254
+	87,	//1255
+	90,	//1256
+	94,	//1257
+	98,	//1258
+	102,	//1259
+	106,	//1260
+	110,	//1261
+	113,	//1262
+	116,	//1263
+	117,	//1264
+	118,	//1265
+	118,	//1266
+	117,	//1267
+	114,	//1268
+	110,	//1269
+	105,	//1270
+	98,	//1271
+	90,	//1272
+	81,	//1273
+	71,	//1274
+	59,	//1275
+	47,	//1276
+	34,	//1277
+	21,	//1278
+	7,	//1279
+	// level 5 - 4 harmonics
+	-3,	//1280
+	-10,	//1281
+	-17,	//1282
+	-24,	//1283
+	-31,	//1284
+	-37,	//1285
+	-44,	//1286
+	-50,	//1287
+	-56,	//1288
+	-62,	//1289
+	-67,	//1290
+	-72,	//1291
+	-77,	//1292
+	-82,	//1293
+	-86,	//1294
+	-90,	//1295
+	-93,	//1296
+	-96,	//1297
+	-99,	//1298
+	-101,	//1299
+	-103,	//1300
+	-105,	//1301
+	-106,	//1302
+	-107,	//1303
+	-108,	//1304
+	-108,	//1305
+	-108,	//1306
+	-107,	//1307
+	-106,	//1308
+	-105,	//1309
+	-104,	//1310
+	-103,	//1311
+	-101,	//1312
+	-99,	//1313
+	-97,	//1314
+	-95,	//1315
+	-92,	//1316
+	-90,	//1317
+	-87,	//1318
+	-85,	//1319
+	-82,	//1320
+	-79,	//1321
+	-77,	//1322
+	-74,	//1323
+	-72,	//1324
+	-69,	//1325
+	-67,	//1326
+	-64,	//1327
+	-62,	//1328
+	-60,	//1329
+	-58,	//1330
+	-57,	//1331
+	-55,	//1332
+	-54,	//1333
+	-52,	//1334
+	-51,	//1335
+	-50,	//1336
+	-49,	//1337
+	-48,	//1338
+	-48,	//1339
+	-47,	//1340
+	-47,	//1341
+	-47,	//1342
+	-47,	//1343
+	-47,	//1344
+	-47,	//1345
+	-47,	//1346
+	-47,	//1347
+	-48,	//1348
+	-48,	//1349
+	-48,	//1350
+	-48,	//1351
+	-49,	//1352
+	-49,	//1353
+	-49,	//1354
+	-49,	//1355
+	-49,	//1356
+	-49,	//1357
+	-49,	//1358
+	-49,	//1359
+	-49,	//1360
+	-48,	//1361
+	-48,	//1362
+	-47,	//1363
+	-46,	//1364
+	-45,	//1365
+	-44,	//1366
+	-43,	//1367
+	-42,	//1368
+	-41,	//1369
+	-40,	//1370
+	-38,	//1371
+	-37,	//1372
+	-35,	//1373
+	-33,	//1374
+	-32,	//1375
+	-30,	//1376
+	-28,	//1377
+	-26,	//1378
+	-25,	//1379
+	-23,	//1380
+	-21,	//1381
+	-19,	//1382
+	-18,	//1383
+	-16,	//1384
+	-14,	//1385
+	-13,	//1386
+	-11,	//1387
+	-10,	//1388
+	-9,	//1389
+	-7,	//1390
+	-6,	//1391
+	-5,	//1392
+	-4,	//1393
+	-4,	//1394
+	-3,	//1395
+	-2,	//1396
+	-2,	//1397
+	-1,	//1398
+	-1,	//1399
+	-1,	//1400
+	0,	//1401
+	0,	//1402
+	0,	//1403
+	0,	//1404
+	0,	//1405
+	0,	//1406
+	0,	//1407
+	0,	//1408
+	0,	//1409
+	0,	//1410
+	0,	//1411
+	0,	//1412
+	0,	//1413
+	0,	//1414
+	1,	//1415
+	1,	//1416
+	1,	//1417
+	2,	//1418
+	2,	//1419
+	3,	//1420
+	4,	//1421
+	4,	//1422
+	5,	//1423
+	6,	//1424
+	7,	//1425
+	9,	//1426
+	10,	//1427
+	11,	//1428
+	13,	//1429
+	14,	//1430
+	16,	//1431
+	18,	//1432
+	19,	//1433
+	21,	//1434
+	23,	//1435
+	25,	//1436
+	26,	//1437
+	28,	//1438
+	30,	//1439
+	32,	//1440
+	33,	//1441
+	35,	//1442
+	37,	//1443
+	38,	//1444
+	40,	//1445
+	41,	//1446
+	42,	//1447
+	43,	//1448
+	44,	//1449
+	45,	//1450
+	46,	//1451
+	47,	//1452
+	48,	//1453
+	48,	//1454
+	49,	//1455
+	49,	//1456
+	49,	//1457
+	49,	//1458
+	49,	//1459
+	49,	//1460
+	49,	//1461
+	49,	//1462
+	49,	//1463
+	48,	//1464
+	48,	//1465
+	48,	//1466
+	48,	//1467
+	47,	//1468
+	47,	//1469
+	47,	//1470
+	47,	//1471
+	47,	//1472
+	47,	//1473
+	47,	//1474
+	47,	//1475
+	48,	//1476
+	48,	//1477
+	49,	//1478
+	50,	//1479
+	51,	//1480
+	52,	//1481
+	54,	//1482
+	55,	//1483
+	57,	//1484
+	58,	//1485
+	60,	//1486
+	62,	//1487
+	64,	//1488
+	67,	//1489
+	69,	//1490
+	72,	//1491
+	74,	//1492
+	77,	//1493
+	79,	//1494
+	82,	//1495
+	85,	//1496
+	87,	//1497
+	90,	//1498
+	92,	//1499
+	95,	//1500
+	97,	//1501
+	99,	//1502
+	101,	//1503
+	103,	//1504
+	104,	//1505
+	105,	//1506
+	106,	//1507
+	107,	//1508
+	108,	//1509
+	108,	//1510
+	108,	//1511
+	107,	//1512
+	106,	//1513
+	105,	//1514
+	103,	//1515
+	101,	//1516
+	99,	//1517
+	96,	//1518
+	93,	//1519
+	90,	//1520
+	86,	//1521
+	82,	//1522
+	77,	//1523
+	72,	//1524
+	67,	//1525
+	62,	//1526
+	56,	//1527
+	50,	//1528
+	44,	//1529
+	37,	//1530
+	31,	//1531
+	24,	//1532
+	17,	//1533
+	10,	//1534
+	3,	//1535
+	// level 6 - 2 harmonics
+	-2,	//1536
+	-5,	//1537
+	-9,	//1538
+	-12,	//1539
+	-16,	//1540
+	-19,	//1541
+	-22,	//1542
+	-26,	//1543
+	-29,	//1544
+	-32,	//1545
+	-35,	//1546
+	-39,	//1547
+	-42,	//1548
+	-45,	//1549
+	-48,	//1550
+	-51,	//1551
+	-53,	//1552
+	-56,	//1553
+	-59,	//1554
+	-61,	//1555
+	-64,	//1556
+	-66,	//1557
+	-69,	//1558
+	-71,	//1559
+	-73,	//1560
+	-75,	//1561
+	-77,	//1562
+	-79,	//1563
+	-80,	//1564
+	-82,	//1565
+	-83,	//1566
+	-85,	//1567
+	-86,	//1568
+	-87,	//1569
+	-88,	//1570
+	-89,	//1571
+	-90,	//1572
+	-90,	//1573
+	-91,	//1574
+	-91,	//1575
+	-91,	//1576
+	-92,	//1577
+	-92,	//1578
+	-92,	//1579
+	-91,	//1580
+	-91,	//1581
+	-91,	//1582
+	-90,	//1583
+	-90,	//1584
+	-89,	//1585
+	-88,	//1586
+	-87,	//1587
+	-87,	//1588
+	-85,	//1589
+	-84,	//1590
+	-83,	//1591
+	-82,	//1592
+	-81,	//1593
+	-79,	//1594
+	-78,	//1595
+	-76,	//1596
+	-75,	//1597
+	-73,	//1598
+	-71,	//1599
+	-69,	//1600
+	-68,	//1601
+	-66,	//1602
+	-64,	//1603
+	-62,	//1604
+	-60,	//1605
+	-58,	//1606
+	-56,	//1607
+	-54,	//1608
+	-53,	//1609
+	-51,	//1610
+	-49,	//1611
+	-47,	//1612
+	-45,	//1613
+	-43,	//1614
+	-41,	//1615
+	-39,	//1616
+	-37,	//1617
+	-35,	//1618
+	-33,	//1619
+	-32,	//1620
+	-30,	//1621
+	-28,	//1622
+	-27,	//1623
+	-25,	//1624
+	-23,	//1625
+	-22,	//1626
+	-20,	//1627
+	-19,	//1628
+	-18,	//1629
+	-16,	//1630
+	-15,	//1631
+	-14,	//1632
+	-13,	//1633
+	-11,	//1634
+	-10,	//1635
+	-9,	//1636
+	-8,	//1637
+	-8,	//1638
+	-7,	//1639
+	-6,	//1640
+	-5,	//1641
+	-5,	//1642
+	-4,	//1643
+	-3,	//1644
+	-3,	//1645
+	-2,	//1646
+	-2,	//1647
+	-2,	//1648
+	-1,	//1649
+	-1,	//1650
+	-1,	//1651
+	-1,	//1652
+	0,	//1653
+	0,	//1654
+	0,	//1655
+	0,	//1656
+	0,	//1657
+	0,	//1658
+	0,	//1659
+	0,	//1660
+	0,	//1661
+	0,	//1662
+	0,	//1663
+	0,	//1664
+	0,	//1665
+	0,	//1666
+	0,	//1667
+	0,	//1668
+	0,	//1669
+	0,	//1670
+	0,	//1671
+	0,	//1672
+	0,	//1673
+	0,	//1674
+	1,	//1675
+	1,	//1676
+	1,	//1677
+	1,	//1678
+	2,	//1679
+	2,	//1680
+	2,	//1681
+	3,	//1682
+	3,	//1683
+	4,	//1684
+	5,	//1685
+	5,	//1686
+	6,	//1687
+	7,	//1688
+	8,	//1689
+	8,	//1690
+	9,	//1691
+	10,	//1692
+	11,	//1693
+	13,	//1694
+	14,	//1695
+	15,	//1696
+	16,	//1697
+	18,	//1698
+	19,	//1699
+	20,	//1700
+	22,	//1701
+	23,	//1702
+	25,	//1703
+	27,	//1704
+	28,	//1705
+	30,	//1706
+	32,	//1707
+	33,	//1708
+	35,	//1709
+	37,	//1710
+	39,	//1711
+	41,	//1712
+	43,	//1713
+	45,	//1714
+	47,	//1715
+	49,	//1716
+	51,	//1717
+	53,	//1718
+	54,	//1719
+	56,	//1720
+	58,	//1721
+	60,	//1722
+	62,	//1723
+	64,	//1724
+	66,	//1725
+	68,	//1726
+	69,	//1727
+	71,	//1728
+	73,	//1729
+	75,	//1730
+	76,	//1731
+	78,	//1732
+	79,	//1733
+	81,	//1734
+	82,	//1735
+	83,	//1736
+	84,	//1737
+	85,	//1738
+	87,	//1739
+	87,	//1740
+	88,	//1741
+	89,	//1742
+	90,	//1743
+	90,	//1744
+	91,	//1745
+	91,	//1746
+	91,	//1747
+	92,	//1748
+	92,	//1749
+	92,	//1750
+	91,	//1751
+	91,	//1752
+	91,	//1753
+	90,	//1754
+	90,	//1755
+	89,	//1756
+	88,	//1757
+	87,	//1758
+	86,	//1759
+	85,	//1760
+	83,	//1761
+	82,	//1762
+	80,	//1763
+	79,	//1764
+	77,	//1765
+	75,	//1766
+	73,	//1767
+	71,	//1768
+	69,	//1769
+	66,	//1770
+	64,	//1771
+	61,	//1772
+	59,	//1773
+	56,	//1774
+	53,	//1775
+	51,	//1776
+	48,	//1777
+	45,	//1778
+	42,	//1779
+	39,	//1780
+	35,	//1781
+	32,	//1782
+	29,	//1783
+	26,	//1784
+	22,	//1785
+	19,	//1786
+	16,	//1787
+	12,	//1788
+	9,	//1789
+	5,	//1790
+	2,	//1791
+	// level 7 - 1 harmonics
+	-1,	//1792
+	-3,	//1793
+	-4,	//1794
+	-6,	//1795
+	-8,	//1796
+	-9,	//1797
+	-11,	//1798
+	-13,	//1799
+	-15,	//1800
+	-16,	//1801
+	-18,	//1802
+	-20,	//1803
+	-21,	//1804
+	-23,	//1805
+	-25,	//1806
+	-26,	//1807
+	-28,	//1808
+	-29,	//1809
+	-31,	//1810
+	-32,	//1811
+	-34,	//1812
+	-35,	//1813
+	-37,	//1814
+	-38,	//1815
+	-40,	//1816
+	-41,	//1817
+	-43,	//1818
+	-44,	//1819
+	-45,	//1820
+	-47,	//1821
+	-48,	//1822
+	-49,	//1823
+	-50,	//1824
+	-52,	//1825
+	-53,	//1826
+	-54,	//1827
+	-55,	//1828
+	-56,	//1829
+	-57,	//1830
+	-58,	//1831
+	-59,	//1832
+	-60,	//1833
+	-61,	//1834
+	-62,	//1835
+	-62,	//1836
+	-63,	//1837
+	-64,	//1838
+	-65,	//1839
+	-65,	//1840
+	-66,	//1841
+	-67,	//1842
+	-67,	//1843
+	-68,	//1844
+	-68,	//1845
+	-68,	//1846
+	-69,	//1847
+	-69,	//1848
+	-69,	//1849
+	-70,	//1850
+	-70,	//1851
+	-70,	//1852
+	-70,	//1853
+	-70,	//1854
+	-70,	//1855
+	-70,	//1856
+	-70,	//1857
+	-70,	//1858
+	-70,	//1859
+	-70,	//1860
+	-70,	//1861
+	-69,	//1862
+	-69,	//1863
+	-69,	//1864
+	-68,	//1865
+	-68,	//1866
+	-68,	//1867
+	-67,	//1868
+	-67,	//1869
+	-66,	//1870
+	-65,	//1871
+	-65,	//1872
+	-64,	//1873
+	-63,	//1874
+	-62,	//1875
+	-62,	//1876
+	-61,	//1877
+	-60,	//1878
+	-59,	//1879
+	-58,	//1880
+	-57,	//1881
+	-56,	//1882
+	-55,	//1883
+	-54,	//1884
+	-53,	//1885
+	-52,	//1886
+	-50,	//1887
+	-49,	//1888
+	-48,	//1889
+	-47,	//1890
+	-45,	//1891
+	-44,	//1892
+	-43,	//1893
+	-41,	//1894
+	-40,	//1895
+	-38,	//1896
+	-37,	//1897
+	-35,	//1898
+	-34,	//1899
+	-32,	//1900
+	-31,	//1901
+	-29,	//1902
+	-28,	//1903
+	-26,	//1904
+	-25,	//1905
+	-23,	//1906
+	-21,	//1907
+	-20,	//1908
+	-18,	//1909
+	-16,	//1910
+	-15,	//1911
+	-13,	//1912
+	-11,	//1913
+	-9,	//1914
+	-8,	//1915
+	-6,	//1916
+	-4,	//1917
+	-3,	//1918
+	-1,	//1919
+	1,	//1920
+	3,	//1921
+	4,	//1922
+	6,	//1923
+	8,	//1924
+	9,	//1925
+	11,	//1926
+	13,	//1927
+	15,	//1928
+	16,	//1929
+	18,	//1930
+	20,	//1931
+	21,	//1932
+	23,	//1933
+	25,	//1934
+	26,	//1935
+	28,	//1936
+	29,	//1937
+	31,	//1938
+	32,	//1939
+	34,	//1940
+	35,	//1941
+	37,	//1942
+	38,	//1943
+	40,	//1944
+	41,	//1945
+	43,	//1946
+	44,	//1947
+	45,	//1948
+	47,	//1949
+	48,	//1950
+	49,	//1951
+	50,	//1952
+	52,	//1953
+	53,	//1954
+	54,	//1955
+	55,	//1956
+	56,	//1957
+	57,	//1958
+	58,	//1959
+	59,	//1960
+	60,	//1961
+	61,	//1962
+	62,	//1963
+	62,	//1964
+	63,	//1965
+	64,	//1966
+	65,	//1967
+	65,	//1968
+	66,	//1969
+	67,	//1970
+	67,	//1971
+	68,	//1972
+	68,	//1973
+	68,	//1974
+	69,	//1975
+	69,	//1976
+	69,	//1977
+	70,	//1978
+	70,	//1979
+	70,	//1980
+	70,	//1981
+	70,	//1982
+	70,	//1983
+	70,	//1984
+	70,	//1985
+	70,	//1986
+	70,	//1987
+	70,	//1988
+	70,	//1989
+	69,	//1990
+	69,	//1991
+	69,	//1992
+	68,	//1993
+	68,	//1994
+	68,	//1995
+	67,	//1996
+	67,	//1997
+	66,	//1998
+	65,	//1999
+	65,	//2000
+	64,	//2001
+	63,	//2002
+	62,	//2003
+	62,	//2004
+	61,	//2005
+	60,	//2006
+	59,	//2007
+	58,	//2008
+	57,	//2009
+	56,	//2010
+	55,	//2011
+	54,	//2012
+	53,	//2013
+	52,	//2014
+	50,	//2015
+	49,	//2016
+	48,	//2017
+	47,	//2018
+	45,	//2019
+	44,	//2020
+	43,	//2021
+	41,	//2022
+	40,	//2023
+	38,	//2024
+	37,	//2025
+	35,	//2026
+	34,	//2027
+	32,	//2028
+	31,	//2029
+	29,	//2030
+	28,	//2031
+	26,	//2032
+	25,	//2033
+	23,	//2034
+	21,	//2035
+	20,	//2036
+	18,	//2037
+	16,	//2038
+	15,	//2039
+	13,	//2040
+	11,	//2041
+	9,	//2042
+	8,	//2043
+	6,	//2044
+	4,	//2045
+	3,	//2046
+	1,	//2047
+};
+
+#endif
@@ -1,9 +1,9 @@
 #ifndef _SAW_
 #define _SAW_
 
-PROGMEM char SawTable[]=
+PROGMEM const signed char SawTable[]=
 {
-	128,	//0
+	-128,	//0 - was 128 which the AVR compiler always wrapped to -128 in a signed char
 	127,	//1
 	126,	//2
 	125,	//3
@@ -0,0 +1,2068 @@
+#ifndef _SAW_MIPMAP_
+#define _SAW_MIPMAP_
+
+// Band limited versions of SawTable for CVoice::setMipmap - made by IllutronB_host/IllutronB_mipmap, do not edit.
+// 8 tables of 256 entries one after the other, level n has the first 128>>n harmonics of SawTable and
+// is played for notes with a wave phase increment up to 256<<n, any higher and its top harmonic would alias.
+
+PROGMEM const signed char SawMipmap[]=
+{
+	// level 0 - 128 harmonics
+	-111,	//0
+	110,	//1
+	109,	//2
+	109,	//3
+	108,	//4
+	107,	//5
+	106,	//6
+	105,	//7
+	104,	//8
+	103,	//9
+	103,	//10
+	102,	//11
+	101,	//12
+	100,	//13
+	99,	//14
+	98,	//15
+	97,	//16
+	96,	//17
+	96,	//18
+	95,	//19
+	94,	//20
+	93,	//21
+	92,	//22
+	91,	//23
+	90,	//24
+	89,	//25
+	89,	//26
+	88,	//27
+	87,	//28
+	86,	//29
+	85,	//30
+	84,	//31
+	83,	//32
+	83,	//33
+	82,	//34
+	81,	//35
+	80,	//36
+	79,	//37
+	78,	//38
+	77,	//39
+	76,	//40
+	76,	//41
+	75,	//42
+	74,	//43
+	73,	//44
+	72,	//45
+	71,	//46
+	70,	//47
+	69,	//48
+	69,	//49
+	68,	//50
+	67,	//51
+	66,	//52
+	65,	//53
+	64,	//54
+	63,	//55
+	63,	//56
+	62,	//57
+	61,	//58
+	60,	//59
+	59,	//60
+	58,	//61
+	57,	//62
+	56,	//63
+	56,	//64
+	55,	//65
+	54,	//66
+	53,	//67
+	52,	//68
+	51,	//69
+	50,	//70
+	50,	//71
+	49,	//72
+	48,	//73
+	47,	//74
+	46,	//75
+	45,	//76
+	44,	//77
+	43,	//78
+	43,	//79
+	42,	//80
+	41,	//81
+	40,	//82
+	39,	//83
+	38,	//84
+	37,	//85
+	36,	//86
+	36,	//87
+	35,	//88
+	34,	//89
+	33,	//90
+	32,	//91
+	31,	//92
+	30,	//93
+	30,	//94
+	29,	//95
+	28,	//96
+	27,	//97
+	26,	//98
+	25,	//99
+	24,	//100
+	23,	//101
+	23,	//102
+	22,	//103
+	21,	//104
+	20,	//105
+	19,	//106
+	18,	//107
+	17,	//108
+	17,	//109
+	16,	//110
+	15,	//111
+	14,	//112
+	13,	//113
+	12,	//114
+	11,	//115
+	10,	//116
+	10,	//117
+	9,	//118
+	8,	//119
+	7,	//120
+	6,	//121
+	5,	//122
+	4,	//123
+	3,	//124
+	3,	//125
+	2,	//126
+	1,	//127
+	0,	//128
+	0,	//129
+	-1,	//130
+	-2,	//131
+	-3,	//132
+	-3,	//133
+	-4,	//134
+	-5,	//135
+	-6,	//136
+	-7,	//137
+	-8,	//138
+	-9,	//139
+	-10,	//140
+	-10,	//141
+	-11,	//142
+	-12,	//143
+	-13,	//144
+	-14,	//145
+	-15,	//146
+	-16,	//147
+	-17,	//148
+	-17,	//149
+	-18,	//150
+	-19,	//151
+	-20,	//152
+	-21,	//153
+	-22,	//154
+	-23,	//155
+	-23,	//156
+	-24,	//157
+	-25,	//158
+	-26,	//159
+	-27,	//160
+	-28,	//161
+	-29,	//162
+	-30,	//163
+	-30,	//164
+	-31,	//165
+	-32,	//166
+	-33,	//167
+	-34,	//168
+	-35,	//169
+	-36,	//170
+	-36,	//171
+	-37,	//172
+	-38,	//173
+	-39,	//174
+	-40,	//175
+	-41,	//176
+	-42,	//177
+	-43,	//178
+	-43,	//179
+	-44,	//180
+	-45,	//181
+	-46,	//182
+	-47,	//183
+	-48,	//184
+	-49,	//185
+	-50,	//186
+	-50,	//187
+	-51,	//188
+	-52,	//189
+	-53,	//190
+	-54,	//191
+	-55,	//192
+	-56,	//193
+	-56,	//194
+	-57,	//195
+	-58,	//196
+	-59,	//197
+	-60,	//198
+	-61,	//199
+	-62,	//200
+	-63,	//201
+	-63,	//202
+	-64,	//203
+	-65,	//204
+	-66,	//205
+	-67,	//206
+	-68,	//207
+	-69,	//208
+	-69,	//209
+	-70,	//210
+	-71,	//211
+	-72,	//212
+	-73,	//213
+	-74,	//214
+	-75,	//215
+	-76,	//216
+	-76,	//217
+	-77,	//218
+	-78,	//219
+	-79,	//220
+	-80,	//221
+	-81,	//222
+	-82,	//223
+	-83,	//224
+	-83,	//225
+	-84,	//226
+	-85,	//227
+	-86,	//228
+	-87,	//229
+	-88,	//230
+	-89,	//231
+	-89,	//232
+	-90,	//233
+	-91,	//234
+	-92,	//235
+	-93,	//236
+	-94,	//237
+	-95,	//238
+	-96,	//239
+	-96,	//240
+	-97,	//241
+	-98,	//242
+	-99,	//243
+	-100,	//244
+	-101,	//245
+	-102,	//246
+	-103,	//247
+	-103,	//248
+	-104,	//249
+	-105,	//250
+	-106,	//251
+	-107,	//252
+	-108,	//253
+	-109,	//254
+	-110,	//255
+	// level 1 - 64 harmonics
+	-56,	//256
+	55,	//257
+	125,	//258
+	123,	//259
+	99,	//260
+	99,	//261
+	112,	//262
+	110,	//263
+	99,	//264
+	99,	//265
+	106,	//266
+	105,	//267
+	97,	//268
+	97,	//269
+	102,	//270
+	100,	//271
+	95,	//272
+	95,	//273
+	98,	//274
+	96,	//275
+	92,	//276
+	92,	//277
+	94,	//278
+	92,	//279
+	88,	//280
+	88,	//281
+	90,	//282
+	89,	//283
+	85,	//284
+	85,	//285
+	87,	//286
+	85,	//287
+	82,	//288
+	82,	//289
+	83,	//290
+	81,	//291
+	79,	//292
+	79,	//293
+	79,	//294
+	78,	//295
+	75,	//296
+	75,	//297
+	76,	//298
+	74,	//299
+	72,	//300
+	72,	//301
+	72,	//302
+	71,	//303
+	68,	//304
+	68,	//305
+	69,	//306
+	67,	//307
+	65,	//308
+	65,	//309
+	65,	//310
+	64,	//311
+	62,	//312
+	62,	//313
+	62,	//314
+	60,	//315
+	58,	//316
+	58,	//317
+	58,	//318
+	56,	//319
+	55,	//320
+	55,	//321
+	55,	//322
+	53,	//323
+	51,	//324
+	51,	//325
+	51,	//326
+	49,	//327
+	48,	//328
+	48,	//329
+	48,	//330
+	46,	//331
+	44,	//332
+	44,	//333
+	44,	//334
+	42,	//335
+	41,	//336
+	41,	//337
+	41,	//338
+	39,	//339
+	38,	//340
+	38,	//341
+	37,	//342
+	35,	//343
+	34,	//344
+	34,	//345
+	34,	//346
+	32,	//347
+	31,	//348
+	31,	//349
+	30,	//350
+	28,	//351
+	27,	//352
+	27,	//353
+	27,	//354
+	25,	//355
+	24,	//356
+	24,	//357
+	23,	//358
+	21,	//359
+	20,	//360
+	20,	//361
+	20,	//362
+	18,	//363
+	17,	//364
+	17,	//365
+	16,	//366
+	14,	//367
+	13,	//368
+	13,	//369
+	13,	//370
+	11,	//371
+	10,	//372
+	10,	//373
+	9,	//374
+	7,	//375
+	6,	//376
+	6,	//377
+	6,	//378
+	4,	//379
+	3,	//380
+	3,	//381
+	2,	//382
+	0,	//383
+	0,	//384
+	0,	//385
+	0,	//386
+	-2,	//387
+	-3,	//388
+	-3,	//389
+	-4,	//390
+	-6,	//391
+	-6,	//392
+	-6,	//393
+	-7,	//394
+	-9,	//395
+	-10,	//396
+	-10,	//397
+	-11,	//398
+	-13,	//399
+	-13,	//400
+	-13,	//401
+	-14,	//402
+	-16,	//403
+	-17,	//404
+	-17,	//405
+	-18,	//406
+	-20,	//407
+	-20,	//408
+	-20,	//409
+	-21,	//410
+	-23,	//411
+	-24,	//412
+	-24,	//413
+	-25,	//414
+	-27,	//415
+	-27,	//416
+	-27,	//417
+	-28,	//418
+	-30,	//419
+	-31,	//420
+	-31,	//421
+	-32,	//422
+	-34,	//423
+	-34,	//424
+	-34,	//425
+	-35,	//426
+	-37,	//427
+	-38,	//428
+	-38,	//429
+	-39,	//430
+	-41,	//431
+	-41,	//432
+	-41,	//433
+	-42,	//434
+	-44,	//435
+	-44,	//436
+	-44,	//437
+	-46,	//438
+	-48,	//439
+	-48,	//440
+	-48,	//441
+	-49,	//442
+	-51,	//443
+	-51,	//444
+	-51,	//445
+	-53,	//446
+	-55,	//447
+	-55,	//448
+	-55,	//449
+	-56,	//450
+	-58,	//451
+	-58,	//452
+	-58,	//453
+	-60,	//454
+	-62,	//455
+	-62,	//456
+	-62,	//457
+	-64,	//458
+	-65,	//459
+	-65,	//460
+	-65,	//461
+	-67,	//462
+	-69,	//463
+	-68,	//464
+	-68,	//465
+	-71,	//466
+	-72,	//467
+	-72,	//468
+	-72,	//469
+	-74,	//470
+	-76,	//471
+	-75,	//472
+	-75,	//473
+	-78,	//474
+	-79,	//475
+	-79,	//476
+	-79,	//477
+	-81,	//478
+	-83,	//479
+	-82,	//480
+	-82,	//481
+	-85,	//482
+	-87,	//483
+	-85,	//484
+	-85,	//485
+	-89,	//486
+	-90,	//487
+	-88,	//488
+	-88,	//489
+	-92,	//490
+	-94,	//491
+	-92,	//492
+	-92,	//493
+	-96,	//494
+	-98,	//495
+	-95,	//496
+	-95,	//497
+	-100,	//498
+	-102,	//499
+	-97,	//500
+	-97,	//501
+	-105,	//502
+	-106,	//503
+	-99,	//504
+	-99,	//505
+	-110,	//506
+	-112,	//507
+	-99,	//508
+	-99,	//509
+	-124,	//510
+	-126,	//511
+	// level 2 - 32 harmonics
+	-28,	//512
+	27,	//513
+	77,	//514
+	112,	//515
+	127,	//516
+	125,	//517
+	114,	//518
+	101,	//519
+	94,	//520
+	94,	//521
+	99,	//522
+	105,	//523
+	108,	//524
+	106,	//525
+	101,	//526
+	95,	//527
+	92,	//528
+	92,	//529
+	94,	//530
+	97,	//531
+	98,	//532
+	97,	//533
+	93,	//534
+	89,	//535
+	86,	//536
+	86,	//537
+	88,	//538
+	90,	//539
+	90,	//540
+	88,	//541
+	85,	//542
+	82,	//543
+	80,	//544
+	80,	//545
+	82,	//546
+	83,	//547
+	83,	//548
+	81,	//549
+	78,	//550
+	75,	//551
+	74,	//552
+	74,	//553
+	75,	//554
+	76,	//555
+	75,	//556
+	73,	//557
+	71,	//558
+	69,	//559
+	67,	//560
+	67,	//561
+	68,	//562
+	68,	//563
+	68,	//564
+	66,	//565
+	64,	//566
+	62,	//567
+	61,	//568
+	61,	//569
+	61,	//570
+	61,	//571
+	61,	//572
+	59,	//573
+	57,	//574
+	55,	//575
+	54,	//576
+	54,	//577
+	54,	//578
+	54,	//579
+	54,	//580
+	52,	//581
+	50,	//582
+	48,	//583
+	47,	//584
+	47,	//585
+	48,	//586
+	47,	//587
+	46,	//588
+	45,	//589
+	43,	//590
+	41,	//591
+	41,	//592
+	41,	//593
+	41,	//594
+	40,	//595
+	39,	//596
+	38,	//597
+	36,	//598
+	34,	//599
+	34,	//600
+	34,	//601
+	34,	//602
+	33,	//603
+	32,	//604
+	30,	//605
+	29,	//606
+	27,	//607
+	27,	//608
+	27,	//609
+	27,	//610
+	26,	//611
+	25,	//612
+	23,	//613
+	22,	//614
+	21,	//615
+	20,	//616
+	20,	//617
+	20,	//618
+	19,	//619
+	18,	//620
+	16,	//621
+	15,	//622
+	14,	//623
+	13,	//624
+	13,	//625
+	13,	//626
+	12,	//627
+	11,	//628
+	9,	//629
+	8,	//630
+	7,	//631
+	6,	//632
+	6,	//633
+	6,	//634
+	5,	//635
+	4,	//636
+	2,	//637
+	1,	//638
+	0,	//639
+	0,	//640
+	0,	//641
+	0,	//642
+	-1,	//643
+	-2,	//644
+	-4,	//645
+	-5,	//646
+	-6,	//647
+	-6,	//648
+	-6,	//649
+	-7,	//650
+	-8,	//651
+	-9,	//652
+	-11,	//653
+	-12,	//654
+	-13,	//655
+	-13,	//656
+	-13,	//657
+	-14,	//658
+	-15,	//659
+	-16,	//660
+	-18,	//661
+	-19,	//662
+	-20,	//663
+	-20,	//664
+	-20,	//665
+	-21,	//666
+	-22,	//667
+	-23,	//668
+	-25,	//669
+	-26,	//670
+	-27,	//671
+	-27,	//672
+	-27,	//673
+	-27,	//674
+	-29,	//675
+	-30,	//676
+	-32,	//677
+	-33,	//678
+	-34,	//679
+	-34,	//680
+	-34,	//681
+	-34,	//682
+	-36,	//683
+	-38,	//684
+	-39,	//685
+	-40,	//686
+	-41,	//687
+	-41,	//688
+	-41,	//689
+	-41,	//690
+	-43,	//691
+	-45,	//692
+	-46,	//693
+	-47,	//694
+	-48,	//695
+	-47,	//696
+	-47,	//697
+	-48,	//698
+	-50,	//699
+	-52,	//700
+	-53,	//701
+	-54,	//702
+	-54,	//703
+	-54,	//704
+	-54,	//705
+	-55,	//706
+	-57,	//707
+	-59,	//708
+	-61,	//709
+	-61,	//710
+	-61,	//711
+	-61,	//712
+	-61,	//713
+	-62,	//714
+	-64,	//715
+	-66,	//716
+	-68,	//717
+	-69,	//718
+	-68,	//719
+	-68,	//720
+	-67,	//721
+	-69,	//722
+	-71,	//723
+	-73,	//724
+	-75,	//725
+	-76,	//726
+	-75,	//727
+	-74,	//728
+	-74,	//729
+	-75,	//730
+	-78,	//731
+	-81,	//732
+	-83,	//733
+	-83,	//734
+	-82,	//735
+	-80,	//736
+	-80,	//737
+	-82,	//738
+	-85,	//739
+	-88,	//740
+	-90,	//741
+	-90,	//742
+	-88,	//743
+	-86,	//744
+	-86,	//745
+	-89,	//746
+	-93,	//747
+	-97,	//748
+	-98,	//749
+	-97,	//750
+	-94,	//751
+	-92,	//752
+	-92,	//753
+	-95,	//754
+	-101,	//755
+	-106,	//756
+	-108,	//757
+	-105,	//758
+	-99,	//759
+	-94,	//760
+	-94,	//761
+	-101,	//762
+	-114,	//763
+	-125,	//764
+	-127,	//765
+	-112,	//766
+	-78,	//767
+	// level 3 - 16 harmonics
+	-14,	//768
+	14,	//769
+	41,	//770
+	65,	//771
+	86,	//772
+	103,	//773
+	115,	//774
+	122,	//775
+	124,	//776
+	122,	//777
+	118,	//778
+	111,	//779
+	104,	//780
+	98,	//781
+	92,	//782
+	88,	//783
+	86,	//784
+	86,	//785
+	88,	//786
+	90,	//787
+	93,	//788
+	96,	//789
+	98,	//790
+	98,	//791
+	98,	//792
+	96,	//793
+	93,	//794
+	90,	//795
+	86,	//796
+	83,	//797
+	81,	//798
+	79,	//799
+	78,	//800
+	78,	//801
+	78,	//802
+	80,	//803
+	81,	//804
+	82,	//805
+	82,	//806
+	82,	//807
+	81,	//808
+	79,	//809
+	77,	//810
+	74,	//811
+	72,	//812
+	69,	//813
+	68,	//814
+	66,	//815
+	66,	//816
+	66,	//817
+	66,	//818
+	67,	//819
+	67,	//820
+	68,	//821
+	68,	//822
+	67,	//823
+	66,	//824
+	64,	//825
+	62,	//826
+	60,	//827
+	58,	//828
+	56,	//829
+	54,	//830
+	53,	//831
+	53,	//832
+	53,	//833
+	53,	//834
+	54,	//835
+	54,	//836
+	54,	//837
+	53,	//838
+	52,	//839
+	51,	//840
+	49,	//841
+	47,	//842
+	45,	//843
+	43,	//844
+	42,	//845
+	41,	//846
+	40,	//847
+	40,	//848
+	40,	//849
+	40,	//850
+	40,	//851
+	40,	//852
+	40,	//853
+	39,	//854
+	38,	//855
+	36,	//856
+	35,	//857
+	33,	//858
+	31,	//859
+	29,	//860
+	28,	//861
+	27,	//862
+	27,	//863
+	26,	//864
+	26,	//865
+	27,	//866
+	27,	//867
+	26,	//868
+	26,	//869
+	25,	//870
+	23,	//871
+	22,	//872
+	20,	//873
+	18,	//874
+	17,	//875
+	15,	//876
+	14,	//877
+	14,	//878
+	13,	//879
+	13,	//880
+	13,	//881
+	13,	//882
+	13,	//883
+	12,	//884
+	12,	//885
+	11,	//886
+	9,	//887
+	8,	//888
+	6,	//889
+	4,	//890
+	3,	//891
+	1,	//892
+	1,	//893
+	0,	//894
+	0,	//895
+	0,	//896
+	0,	//897
+	0,	//898
+	0,	//899
+	-1,	//900
+	-1,	//901
+	-3,	//902
+	-4,	//903
+	-6,	//904
+	-8,	//905
+	-9,	//906
+	-11,	//907
+	-12,	//908
+	-12,	//909
+	-13,	//910
+	-13,	//911
+	-13,	//912
+	-13,	//913
+	-13,	//914
+	-14,	//915
+	-14,	//916
+	-15,	//917
+	-17,	//918
+	-18,	//919
+	-20,	//920
+	-22,	//921
+	-23,	//922
+	-25,	//923
+	-26,	//924
+	-26,	//925
+	-27,	//926
+	-27,	//927
+	-26,	//928
+	-26,	//929
+	-27,	//930
+	-27,	//931
+	-28,	//932
+	-29,	//933
+	-31,	//934
+	-33,	//935
+	-35,	//936
+	-36,	//937
+	-38,	//938
+	-39,	//939
+	-40,	//940
+	-40,	//941
+	-40,	//942
+	-40,	//943
+	-40,	//944
+	-40,	//945
+	-40,	//946
+	-41,	//947
+	-42,	//948
+	-43,	//949
+	-45,	//950
+	-47,	//951
+	-49,	//952
+	-51,	//953
+	-52,	//954
+	-53,	//955
+	-54,	//956
+	-54,	//957
+	-54,	//958
+	-53,	//959
+	-53,	//960
+	-53,	//961
+	-53,	//962
+	-54,	//963
+	-56,	//964
+	-58,	//965
+	-60,	//966
+	-62,	//967
+	-64,	//968
+	-66,	//969
+	-67,	//970
+	-68,	//971
+	-68,	//972
+	-67,	//973
+	-67,	//974
+	-66,	//975
+	-66,	//976
+	-66,	//977
+	-66,	//978
+	-68,	//979
+	-69,	//980
+	-72,	//981
+	-74,	//982
+	-77,	//983
+	-79,	//984
+	-81,	//985
+	-82,	//986
+	-82,	//987
+	-82,	//988
+	-81,	//989
+	-80,	//990
+	-78,	//991
+	-78,	//992
+	-78,	//993
+	-79,	//994
+	-80,	//995
+	-83,	//996
+	-86,	//997
+	-90,	//998
+	-93,	//999
+	-96,	//1000
+	-98,	//1001
+	-98,	//1002
+	-98,	//1003
+	-96,	//1004
+	-93,	//1005
+	-90,	//1006
+	-88,	//1007
+	-86,	//1008
+	-86,	//1009
+	-88,	//1010
+	-92,	//1011
+	-97,	//1012
+	-104,	//1013
+	-111,	//1014
+	-118,	//1015
+	-122,	//1016
+	-124,	//1017
+	-122,	//1018
+	-115,	//1019
+	-103,	//1020
+	-87,	//1021
+	-66,	//1022
+	-41,	//1023
+	// level 4 - 8 harmonics
+	-7,	//1024
+	7,	//1025
+	21,	//1026
+	34,	//1027
+	47,	//1028
+	59,	//1029
+	70,	//1030
+	81,	//1031
+	90,	//1032
+	98,	//1033
+	104,	//1034
+	110,	//1035
+	114,	//1036
+	116,	//1037
+	118,	//1038
+	118,	//1039
+	117,	//1040
+	115,	//1041
+	113,	//1042
+	110,	//1043
+	106,	//1044
+	102,	//1045
+	98,	//1046
+	94,	//1047
+	90,	//1048
+	86,	//1049
+	83,	//1050
+	80,	//1051
+	78,	//1052
+	76,	//1053
+	74,	//1054
+	73,	//1055
+	73,	//1056
+	73,	//1057
+	73,	//1058
+	74,	//1059
+	75,	//1060
+	76,	//1061
+	77,	//1062
+	78,	//1063
+	79,	//1064
+	80,	//1065
+	80,	//1066
+	80,	//1067
+	80,	//1068
+	80,	//1069
+	79,	//1070
+	78,	//1071
+	76,	//1072
+	75,	//1073
+	73,	//1074
+	71,	//1075
+	68,	//1076
+	66,	//1077
+	64,	//1078
+	61,	//1079
+	59,	//1080
+	57,	//1081
+	56,	//1082
+	54,	//1083
+	53,	//1084
+	52,	//1085
+	51,	//1086
+	51,	//1087
+	51,	//1088
+	51,	//1089
+	51,	//1090
+	51,	//1091
+	52,	//1092
+	52,	//1093
+	52,	//1094
+	52,	//1095
+	52,	//1096
+	52,	//1097
+	52,	//1098
+	51,	//1099
+	50,	//1100
+	49,	//1101
+	48,	//1102
+	47,	//1103
+	45,	//1104
+	43,	//1105
+	41,	//1106
+	40,	//1107
+	38,	//1108
+	36,	//1109
+	34,	//1110
+	32,	//1111
+	31,	//1112
+	30,	//1113
+	28,	//1114
+	28,	//1115
+	27,	//1116
+	26,	//1117
+	26,	//1118
+	26,	//1119
+	26,	//1120
+	26,	//1121
+	26,	//1122
+	26,	//1123
+	26,	//1124
+	26,	//1125
+	26,	//1126
+	25,	//1127
+	25,	//1128
+	24,	//1129
+	23,	//1130
+	22,	//1131
+	21,	//1132
+	20,	//1133
+	18,	//1134
+	17,	//1135
+	15,	//1136
+	13,	//1137
+	12,	//1138
+	10,	//1139
+	8,	//1140
+	7,	//1141
+	5,	//1142
+	4,	//1143
+	3,	//1144
+	2,	//1145
+	1,	//1146
+	1,	//1147
+	0,	//1148
+	0,	//1149
+	0,	//1150
+	0,	//1151
+	0,	//1152
+	0,	//1153
+	0,	//1154
+	0,	//1155
+	0,	//1156
+	0,	//1157
+	-1,	//1158
+	-1,	//1159
+	-2,	//1160
+	-3,	//1161
+	-4,	//1162
+	-5,	//1163
+	-7,	//1164
+	-8,	//1165
+	-10,	//1166
+	-12,	//1167
+	-13,	//1168
+	-15,	//1169
+	-17,	//1170
+	-18,	//1171
+	-20,	//1172
+	-21,	//1173
+	-22,	//1174
+	-23,	//1175
+	-24,	//1176
+	-25,	//1177
+	-25,	//1178
+	-26,	//1179
+	-26,	//1180
+	-26,	//1181
+	-26,	//1182
+	-26,	//1183
+	-26,	//1184
+	-26,	//1185
+	-26,	//1186
+	-26,	//1187
+	-26,	//1188
+	-27,	//1189
+	-28,	//1190
+	-28,	//1191
+	-30,	//1192
+	-31,	//1193
+	-32,	//1194
+	-34,	//1195
+	-36,	//1196
+	-38,	//1197
+	-40,	//1198
+	-41,	//1199
+	-43,	//1200
+	-45,	//1201
+	-47,	//1202
+	-48,	//1203
+	-49,	//1204
+	-50,	//1205
+	-51,	//1206
+	-52,	//1207
+	-52,	//1208
+	-52,	//1209
+	-52,	//1210
+	-52,	//1211
+	-52,	//1212
+	-52,	//1213
+	-51,	//1214
+	-51,	//1215
+	-51,	//1216
+	-51,	//1217
+	-51,	//1218
+	-51,	//1219
+	-52,	//1220
+	-53,	//1221
+	-54,	//1222
+	-56,	//1223
+	-57,	//1224
+	-59,	//1225
+	-61,	//1226
+	-64,	//1227
+	-66,	//1228
+	-68,	//1229
+	-70,	//1230
+	-73,	//1231
+	-75,	//1232
+	-76,	//1233
+	-78,	//1234
+	-79,	//1235
+	-80,	//1236
+	-80,	//1237
+	-80,	//1238
+	-80,	//1239
+	-80,	//1240
+	-79,	//1241
+	-78,	//1242
+	-77,	//1243
+	-76,	//1244
+	-75,	//1245
+	-74,	//1246
+	-73,	//1247
+	-73,	//1248
+	-73,	//1249
+	-73,	//1250
+	-74,	//1251
+	-76,	//1252
+	-78,	//1253
+	-80,	//1254
+	-83,	//1255
+	-86,	//1256
+	-90,	//1257
+	-94,	//1258
+	-98,	//1259
+	-102,	//1260
+	-106,	//1261
+	-110,	//1262
+	-113,	//1263
+	-115,	//1264
+	-117,	//1265
+	-118,	//1266
+	-118,	//1267
+	-116,	//1268
+	-114,	//1269
+	-110,	//1270
+	-105,	//1271
+	-98,	//1272
+	-90,	//1273
+	-81,	//1274
+	-71,	//1275
+	-59,	//1276
+	-47,	//1277
+	-34,	//1278
+	-21,	//1279
+	// level 5 - 4 harmonics
+	-4,	//1280
+	3,	//1281
+	10,	//1282
+	17,	//1283
+	24,	//1284
+	31,	//1285
+	37,	//1286
+	44,	//1287
+	50,	//1288
+	56,	//1289
+	61,	//1290
+	67,	//1291
+	72,	//1292
+	77,	//1293
+	81,	//1294
+	86,	//1295
+	89,	//1296
+	93,	//1297
+	96,	//1298
+	99,	//1299
+	101,	//1300
+	103,	//1301
+	105,	//1302
+	106,	//1303
+	107,	//1304
+	107,	//1305
+	108,	//1306
+	107,	//1307
+	107,	//1308
+	106,	//1309
+	105,	//1310
+	104,	//1311
+	102,	//1312
+	101,	//1313
+	99,	//1314
+	97,	//1315
+	94,	//1316
+	92,	//1317
+	90,	//1318
+	87,	//1319
+	84,	//1320
+	82,	//1321
+	79,	//1322
+	77,	//1323
+	74,	//1324
+	71,	//1325
+	69,	//1326
+	67,	//1327
+	64,	//1328
+	62,	//1329
+	60,	//1330
+	58,	//1331
+	56,	//1332
+	55,	//1333
+	53,	//1334
+	52,	//1335
+	51,	//1336
+	50,	//1337
+	49,	//1338
+	48,	//1339
+	48,	//1340
+	47,	//1341
+	47,	//1342
+	47,	//1343
+	47,	//1344
+	47,	//1345
+	47,	//1346
+	47,	//1347
+	47,	//1348
+	47,	//1349
+	48,	//1350
+	48,	//1351
+	48,	//1352
+	48,	//1353
+	49,	//1354
+	49,	//1355
+	49,	//1356
+	49,	//1357
+	49,	//1358
+	49,	//1359
+	49,	//1360
+	48,	//1361
+	48,	//1362
+	48,	//1363
+	47,	//1364
+	46,	//1365
+	45,	//1366
+	44,	//1367
+	43,	//1368
+	42,	//1369
+	41,	//1370
+	40,	//1371
+	38,	//1372
+	37,	//1373
+	35,	//1374
+	33,	//1375
+	32,	//1376
+	30,	//1377
+	28,	//1378
+	26,	//1379
+	25,	//1380
+	23,	//1381
+	21,	//1382
+	19,	//1383
+	18,	//1384
+	16,	//1385
+	14,	//1386
+	13,	//1387
+	11,	//1388
+	10,	//1389
+	9,	//1390
+	7,	//1391
+	6,	//1392
+	5,	//1393
+	4,	//1394
+	4,	//1395
+	3,	//1396
+	2,	//1397
+	2,	//1398
+	1,	//1399
+	1,	//1400
+	1,	//1401
+	0,	//1402
+	0,	//1403
+	0,	//1404
+	0,	//1405
+	0,	//1406
+	0,	//1407
+	0,	//1408
+	0,	//1409
+	0,	//1410
+	0,	//1411
+	0,	//1412
+	0,	//1413
+	0,	//1414
+	0,	//1415
+	-1,	//1416
+	-1,	//1417
+	-1,	//1418
+	-2,	//1419
+	-2,	//1420
+	-3,	//1421
+	-4,	//1422
+	-4,	//1423
+	-5,	//1424
+	-6,	//1425
+	-7,	//1426
+	-9,	//1427
+	-10,	//1428
+	-11,	//1429
+	-13,	//1430
+	-14,	//1431
+	-16,	//1432
+	-18,	//1433
+	-19,	//1434
+	-21,	//1435
+	-23,	//1436
+	-25,	//1437
+	-26,	//1438
+	-28,	//1439
+	-30,	//1440
+	-32,	//1441
+	-33,	//1442
+	-35,	//1443
+	-37,	//1444
+	-38,	//1445
+	-40,	//1446
+	-41,	//1447
+	-42,	//1448
+	-43,	//1449
+	-44,	//1450
+	-45,	//1451
+	-46,	//1452
+	-47,	//1453
+	-48,	//1454
+	-48,	//1455
+	-48,	//1456
+	-49,	//1457
+	-49,	//1458
+	-49,	//1459
+	-49,	//1460
+	-49,	//1461
+	-49,	//1462
+	-49,	//1463
+	-49,	//1464
+	-48,	//1465
+	-48,	//1466
+	-48,	//1467
+	-47,	//1468
+	-47,	//1469
+	-47,	//1470
+	-47,	//1471
+	-47,	//1472
+	-47,	//1473
+	-47,	//1474
+	-47,	//1475
+	-47,	//1476
+	-48,	//1477
+	-48,	//1478
+	-49,	//1479
+	-50,	//1480
+	-51,	//1481
+	-52,	//1482
+	-53,	//1483
+	-55,	//1484
+	-56,	//1485
+	-58,	//1486
+	-60,	//1487
+	-62,	//1488
+	-64,	//1489
+	-67,	//1490
+	-69,	//1491
+	-71,	//1492
+	-74,	//1493
+	-77,	//1494
+	-79,	//1495
+	-82,	//1496
+	-84,	//1497
+	-87,	//1498
+	-90,	//1499
+	-92,	//1500
+	-94,	//1501
+	-97,	//1502
+	-99,	//1503
+	-101,	//1504
+	-102,	//1505
+	-104,	//1506
+	-105,	//1507
+	-106,	//1508
+	-107,	//1509
+	-107,	//1510
+	-108,	//1511
+	-107,	//1512
+	-107,	//1513
+	-106,	//1514
+	-105,	//1515
+	-103,	//1516
+	-101,	//1517
+	-99,	//1518
+	-96,	//1519
+	-93,	//1520
+	-89,	//1521
+	-86,	//1522
+	-81,	//1523
+	-77,	//1524
+	-72,	//1525
+	-67,	//1526
+	-61,	//1527
+	-56,	//1528
+	-50,	//1529
+	-44,	//1530
+	-37,	//1531
+	-31,	//1532
+	-24,	//1533
+	-17,	//1534
+	-10,	//1535
+	// level 6 - 2 harmonics
+	-2,	//1536
+	2,	//1537
+	5,	//1538
+	9,	//1539
+	12,	//1540
+	15,	//1541
+	19,	//1542
+	22,	//1543
+	26,	//1544
+	29,	//1545
+	32,	//1546
+	35,	//1547
+	38,	//1548
+	42,	//1549
+	45,	//1550
+	48,	//1551
+	50,	//1552
+	53,	//1553
+	56,	//1554
+	59,	//1555
+	61,	//1556
+	64,	//1557
+	66,	//1558
+	68,	//1559
+	71,	//1560
+	73,	//1561
+	75,	//1562
+	77,	//1563
+	78,	//1564
+	80,	//1565
+	82,	//1566
+	83,	//1567
+	84,	//1568
+	86,	//1569
+	87,	//1570
+	88,	//1571
+	89,	//1572
+	89,	//1573
+	90,	//1574
+	91,	//1575
+	91,	//1576
+	91,	//1577
+	91,	//1578
+	91,	//1579
+	91,	//1580
+	91,	//1581
+	91,	//1582
+	91,	//1583
+	90,	//1584
+	90,	//1585
+	89,	//1586
+	88,	//1587
+	87,	//1588
+	86,	//1589
+	85,	//1590
+	84,	//1591
+	83,	//1592
+	82,	//1593
+	80,	//1594
+	79,	//1595
+	78,	//1596
+	76,	//1597
+	74,	//1598
+	73,	//1599
+	71,	//1600
+	69,	//1601
+	68,	//1602
+	66,	//1603
+	64,	//1604
+	62,	//1605
+	60,	//1606
+	58,	//1607
+	56,	//1608
+	54,	//1609
+	52,	//1610
+	50,	//1611
+	49,	//1612
+	47,	//1613
+	45,	//1614
+	43,	//1615
+	41,	//1616
+	39,	//1617
+	37,	//1618
+	35,	//1619
+	33,	//1620
+	32,	//1621
+	30,	//1622
+	28,	//1623
+	27,	//1624
+	25,	//1625
+	23,	//1626
+	22,	//1627
+	20,	//1628
+	19,	//1629
+	17,	//1630
+	16,	//1631
+	15,	//1632
+	14,	//1633
+	13,	//1634
+	11,	//1635
+	10,	//1636
+	9,	//1637
+	8,	//1638
+	8,	//1639
+	7,	//1640
+	6,	//1641
+	5,	//1642
+	5,	//1643
+	4,	//1644
+	3,	//1645
+	3,	//1646
+	2,	//1647
+	2,	//1648
+	2,	//1649
+	1,	//1650
+	1,	//1651
+	1,	//1652
+	1,	//1653
+	0,	//1654
+	0,	//1655
+	0,	//1656
+	0,	//1657
+	0,	//1658
+	0,	//1659
+	0,	//1660
+	0,	//1661
+	0,	//1662
+	0,	//1663
+	0,	//1664
+	0,	//1665
+	0,	//1666
+	0,	//1667
+	0,	//1668
+	0,	//1669
+	0,	//1670
+	0,	//1671
+	0,	//1672
+	0,	//1673
+	0,	//1674
+	0,	//1675
+	-1,	//1676
+	-1,	//1677
+	-1,	//1678
+	-1,	//1679
+	-2,	//1680
+	-2,	//1681
+	-2,	//1682
+	-3,	//1683
+	-3,	//1684
+	-4,	//1685
+	-5,	//1686
+	-5,	//1687
+	-6,	//1688
+	-7,	//1689
+	-8,	//1690
+	-8,	//1691
+	-9,	//1692
+	-10,	//1693
+	-11,	//1694
+	-12,	//1695
+	-14,	//1696
+	-15,	//1697
+	-16,	//1698
+	-17,	//1699
+	-19,	//1700
+	-20,	//1701
+	-22,	//1702
+	-23,	//1703
+	-25,	//1704
+	-27,	//1705
+	-28,	//1706
+	-30,	//1707
+	-32,	//1708
+	-33,	//1709
+	-35,	//1710
+	-37,	//1711
+	-39,	//1712
+	-41,	//1713
+	-43,	//1714
+	-45,	//1715
+	-47,	//1716
+	-49,	//1717
+	-50,	//1718
+	-52,	//1719
+	-54,	//1720
+	-56,	//1721
+	-58,	//1722
+	-60,	//1723
+	-62,	//1724
+	-64,	//1725
+	-66,	//1726
+	-68,	//1727
+	-69,	//1728
+	-71,	//1729
+	-73,	//1730
+	-74,	//1731
+	-76,	//1732
+	-78,	//1733
+	-79,	//1734
+	-80,	//1735
+	-82,	//1736
+	-83,	//1737
+	-84,	//1738
+	-85,	//1739
+	-86,	//1740
+	-87,	//1741
+	-88,	//1742
+	-89,	//1743
+	-90,	//1744
+	-90,	//1745
+	-91,	//1746
+	-91,	//1747
+	-91,	//1748
+	-91,	//1749
+	-91,	//1750
+	-91,	//1751
+	-91,	//1752
+	-91,	//1753
+	-91,	//1754
+	-90,	//1755
+	-89,	//1756
+	-89,	//1757
+	-88,	//1758
+	-87,	//1759
+	-86,	//1760
+	-84,	//1761
+	-83,	//1762
+	-82,	//1763
+	-80,	//1764
+	-78,	//1765
+	-77,	//1766
+	-75,	//1767
+	-73,	//1768
+	-71,	//1769
+	-68,	//1770
+	-66,	//1771
+	-64,	//1772
+	-61,	//1773
+	-59,	//1774
+	-56,	//1775
+	-53,	//1776
+	-51,	//1777
+	-48,	//1778
+	-45,	//1779
+	-42,	//1780
+	-39,	//1781
+	-35,	//1782
+	-32,	//1783
+	-29,	//1784
+	-26,	//1785
+	-22,	//1786
+	-19,	//1787
+	-16,	//1788
+	-12,	//1789
+	-9,	//1790
+	-5,	//1791
+	// level 7 - 1 harmonics
+	-1,	//1792
+	1,	//1793
+	3,	//1794
+	4,	//1795
+	6,	//1796
+	8,	//1797
+	9,	//1798
+	11,	//1799
+	13,	//1800
+	15,	//1801
+	16,	//1802
+	18,	//1803
+	20,	//1804
+	21,	//1805
+	23,	//1806
+	24,	//1807
+	26,	//1808
+	28,	//1809
+	29,	//1810
+	31,	//1811
+	32,	//1812
+	34,	//1813
+	35,	//1814
+	37,	//1815
+	38,	//1816
+	40,	//1817
+	41,	//1818
+	43,	//1819
+	44,	//1820
+	45,	//1821
+	47,	//1822
+	48,	//1823
+	49,	//1824
+	50,	//1825
+	51,	//1826
+	53,	//1827
+	54,	//1828
+	55,	//1829
+	56,	//1830
+	57,	//1831
+	58,	//1832
+	59,	//1833
+	60,	//1834
+	61,	//1835
+	62,	//1836
+	62,	//1837
+	63,	//1838
+	64,	//1839
+	65,	//1840
+	65,	//1841
+	66,	//1842
+	66,	//1843
+	67,	//1844
+	67,	//1845
+	68,	//1846
+	68,	//1847
+	69,	//1848
+	69,	//1849
+	69,	//1850
+	70,	//1851
+	70,	//1852
+	70,	//1853
+	70,	//1854
+	70,	//1855
+	70,	//1856
+	70,	//1857
+	70,	//1858
+	70,	//1859
+	70,	//1860
+	70,	//1861
+	70,	//1862
+	69,	//1863
+	69,	//1864
+	69,	//1865
+	68,	//1866
+	68,	//1867
+	67,	//1868
+	67,	//1869
+	66,	//1870
+	66,	//1871
+	65,	//1872
+	65,	//1873
+	64,	//1874
+	63,	//1875
+	62,	//1876
+	62,	//1877
+	61,	//1878
+	60,	//1879
+	59,	//1880
+	58,	//1881
+	57,	//1882
+	56,	//1883
+	55,	//1884
+	54,	//1885
+	53,	//1886
+	51,	//1887
+	50,	//1888
+	49,	//1889
+	48,	//1890
+	47,	//1891
+	45,	//1892
+	44,	//1893
+	43,	//1894
+	41,	//1895
+	40,	//1896
+	38,	//1897
+	37,	//1898
+	35,	//1899
+	34,	//1900
+	32,	//1901
+	31,	//1902
+	29,	//1903
+	28,	//1904
+	26,	//1905
+	24,	//1906
+	23,	//1907
+	21,	//1908
+	20,	//1909
+	18,	//1910
+	16,	//1911
+	15,	//1912
+	13,	//1913
+	11,	//1914
+	9,	//1915
+	8,	//1916
+	6,	//1917
+	4,	//1918
+	3,	//1919
+	1,	//1920
+	-1,	//1921
+	-3,	//1922
+	-4,	//1923
+	-6,	//1924
+	-8,	//1925
+	-9,	//1926
+	-11,	//1927
+	-13,	//1928
+	-15,	//1929
+	-16,	//1930
+	-18,	//1931
+	-20,	//1932
+	-21,	//1933
+	-23,	//1934
+	-24,	//1935
+	-26,	//1936
+	-28,	//1937
+	-29,	//1938
+	-31,	//1939
+	-32,	//1940
+	-34,	//1941
+	-35,	//1942
+	-37,	//1943
+	-38,	//1944
+	-40,	//1945
+	-41,	//1946
+	-43,	//1947
+	-44,	//1948
+	-45,	//1949
+	-47,	//1950
+	-48,	//1951
+	-49,	//1952
+	-50,	//1953
+	-51,	//1954
+	-53,	//1955
+	-54,	//1956
+	-55,	//1957
+	-56,	//1958
+	-57,	//1959
+	-58,	//1960
+	-59,	//1961
+	-60,	//1962
+	-61,	//1963
+	-62,	//1964
+	-62,	//1965
+	-63,	//1966
+	-64,	//1967
+	-65,	//1968
+	-65,	//1969
+	-66,	//1970
+	-66,	//1971
+	-67,	//1972
+	-67,	//1973
+	-68,	//1974
+	-68,	//1975
+	-69,	//1976
+	-69,	//1977
+	-69,	//1978
+	-70,	//1979
+	-70,	//1980
+	-70,	//1981
+	-70,	//1982
+	-70,	//1983
+	-70,	//1984
+	-70,	//1985
+	-70,	//1986
+	-70,	//1987
+	-70,	//1988
+	-70,	//1989
+	-70,	//1990
+	-69,	//1991
+	-69,	//1992
+	-69,	//1993
+	-68,	//1994
+	-68,	//1995
+	-67,	//1996
+	-67,	//1997
+	-66,	//1998
+	-66,	//1999
+	-65,	//2000
+	-65,	//2001
+	-64,	//2002
+	-63,	//2003
+	-62,	//2004
+	-62,	//2005
+	-61,	//2006
+	-60,	//2007
+	-59,	//2008
+	-58,	//2009
+	-57,	//2010
+	-56,	//2011
+	-55,	//2012
+	-54,	//2013
+	-53,	//2014
+	-51,	//2015
+	-50,	//2016
+	-49,	//2017
+	-48,	//2018
+	-47,	//2019
+	-45,	//2020
+	-44,	//2021
+	-43,	//2022
+	-41,	//2023
+	-40,	//2024
+	-38,	//2025
+	-37,	//2026
+	-35,	//2027
+	-34,	//2028
+	-32,	//2029
+	-31,	//2030
+	-29,	//2031
+	-28,	//2032
+	-26,	//2033
+	-24,	//2034
+	-23,	//2035
+	-21,	//2036
+	-20,	//2037
+	-18,	//2038
+	-16,	//2039
+	-15,	//2040
+	-13,	//2041
+	-11,	//2042
+	-9,	//2043
+	-8,	//2044
+	-6,	//2045
+	-4,	//2046
+	-3,	//2047
+};
+
+#endif
@@ -1,7 +1,7 @@
 #ifndef _SIN_
 #define _SIN_
 
-PROGMEM char SinTable[]=
+PROGMEM const signed char SinTable[]=
 {
 	0,	//0
 	3,	//1
@@ -1,7 +1,7 @@
 #ifndef _SQUARE_
 #define _SQUARE_
 
-PROGMEM char  SquareTable[]=
+PROGMEM const signed char SquareTable[]=
 {
 	127,	//0
 	127,	//1
@@ -0,0 +1,2068 @@
+#ifndef _SQUARE_MIPMAP_
+#define _SQUARE_MIPMAP_
+
+// Band limited versions of SquareTable for CVoice::setMipmap - made by IllutronB_host/IllutronB_mipmap, do not edit.
+// 8 tables of 256 entries one after the other, level n has the first 128>>n harmonics of SquareTable and
+// is played for notes with a wave phase increment up to 256<<n, any higher and its top harmonic would alias.
+
+PROGMEM const signed char SquareMipmap[]=
+{
+	// level 0 - 128 harmonics
+	100,	//0
+	100,	//1
+	100,	//2
+	100,	//3
+	100,	//4
+	100,	//5
+	100,	//6
+	100,	//7
+	100,	//8
+	100,	//9
+	100,	//10
+	100,	//11
+	100,	//12
+	100,	//13
+	100,	//14
+	100,	//15
+	100,	//16
+	100,	//17
+	100,	//18
+	100,	//19
+	100,	//20
+	100,	//21
+	100,	//22
+	100,	//23
+	100,	//24
+	100,	//25
+	100,	//26
+	100,	//27
+	100,	//28
+	100,	//29
+	100,	//30
+	100,	//31
+	100,	//32
+	100,	//33
+	100,	//34
+	100,	//35
+	100,	//36
+	100,	//37
+	100,	//38
+	100,	//39
+	100,	//40
+	100,	//41
+	100,	//42
+	100,	//43
+	100,	//44
+	100,	//45
+	100,	//46
+	100,	//47
+	100,	//48
+	100,	//49
+	100,	//50
+	100,	//51
+	100,	//52
+	100,	//53
+	100,	//54
+	100,	//55
+	100,	//56
+	100,	//57
+	100,	//58
+	100,	//59
+	100,	//60
+	100,	//61
+	100,	//62
+	100,	//63
+	100,	//64
+	100,	//65
+	100,	//66
+	100,	//67
+	100,	//68
+	100,	//69
+	100,	//70
+	100,	//71
+	100,	//72
+	100,	//73
+	100,	//74
+	100,	//75
+	100,	//76
+	100,	//77
+	100,	//78
+	100,	//79
+	100,	//80
+	100,	//81
+	100,	//82
+	100,	//83
+	100,	//84
+	100,	//85
+	100,	//86
+	100,	//87
+	100,	//88
+	100,	//89
+	100,	//90
+	100,	//91
+	100,	//92
+	100,	//93
+	100,	//94
+	100,	//95
+	100,	//96
+	100,	//97
+	100,	//98
+	100,	//99
+	100,	//100
+	100,	//101
+	100,	//102
+	100,	//103
+	100,	//104
+	100,	//105
+	100,	//106
+	100,	//107
+	100,	//108
+	100,	//109
+	100,	//110
+	100,	//111
+	100,	//112
+	100,	//113
+	100,	//114
+	100,	//115
+	100,	//116
+	100,	//117
+	100,	//118
+	100,	//119
+	100,	//120
+	100,	//121
+	100,	//122
+	100,	//123
+	100,	//124
+	100,	//125
+	100,	//126
+	100,	//127
+	-98,	//128
+	-98,	//129
+	-98,	//130
+	-98,	//131
+	-98,	//132
+	-98,	//133
+	-98,	//134
+	-98,	//135
+	-98,	//136
+	-98,	//137
+	-98,	//138
+	-98,	//139
+	-98,	//140
+	-98,	//141
+	-98,	//142
+	-98,	//143
+	-98,	//144
+	-98,	//145
+	-98,	//146
+	-98,	//147
+	-98,	//148
+	-98,	//149
+	-98,	//150
+	-98,	//151
+	-98,	//152
+	-98,	//153
+	-98,	//154
+	-98,	//155
+	-98,	//156
+	-98,	//157
+	-98,	//158
+	-98,	//159
+	-98,	//160
+	-98,	//161
+	-98,	//162
+	-98,	//163
+	-98,	//164
+	-98,	//165
+	-98,	//166
+	-98,	//167
+	-98,	//168
+	-98,	//169
+	-98,	//170
+	-98,	//171
+	-98,	//172
+	-98,	//173
+	-98,	//174
+	-98,	//175
+	-98,	//176
+	-98,	//177
+	-98,	//178
+	-98,	//179
+	-98,	//180
+	-98,	//181
+	-98,	//182
+	-98,	//183
+	-98,	//184
+	-98,	//185
+	-98,	//186
+	-98,	//187
+	-98,	//188
+	-98,	//189
+	-98,	//190
+	-98,	//191
+	-98,	//192
+	-98,	//193
+	-98,	//194
+	-98,	//195
+	-98,	//196
+	-98,	//197
+	-98,	//198
+	-98,	//199
+	-98,	//200
+	-98,	//201
+	-98,	//202
+	-98,	//203
+	-98,	//204
+	-98,	//205
+	-98,	//206
+	-98,	//207
+	-98,	//208
+	-98,	//209
+	-98,	//210
+	-98,	//211
+	-98,	//212
+	-98,	//213
+	-98,	//214
+	-98,	//215
+	-98,	//216
+	-98,	//217
+	-98,	//218
+	-98,	//219
+	-98,	//220
+	-98,	//221
+	-98,	//222
+	-98,	//223
+	-98,	//224
+	-98,	//225
+	-98,	//226
+	-98,	//227
+	-98,	//228
+	-98,	//229
+	-98,	//230
+	-98,	//231
+	-98,	//232
+	-98,	//233
+	-98,	//234
+	-98,	//235
+	-98,	//236
+	-98,	//237
+	-98,	//238
+	-98,	//239
+	-98,	//240
+	-98,	//241
+	-98,	//242
+	-98,	//243
+	-98,	//244
+	-98,	//245
+	-98,	//246
+	-98,	//247
+	-98,	//248
+	-98,	//249
+	-98,	//250
+	-98,	//251
+	-98,	//252
+	-98,	//253
+	-98,	//254
+	-1,	//255
+	// level 1 - 64 harmonics
+	81,	//256
+	113,	//257
+	103,	//258
+	93,	//259
+	98,	//260
+	104,	//261
+	100,	//262
+	96,	//263
+	99,	//264
+	102,	//265
+	100,	//266
+	97,	//267
+	99,	//268
+	102,	//269
+	100,	//270
+	98,	//271
+	99,	//272
+	101,	//273
+	100,	//274
+	98,	//275
+	99,	//276
+	101,	//277
+	100,	//278
+	99,	//279
+	99,	//280
+	101,	//281
+	100,	//282
+	99,	//283
+	99,	//284
+	100,	//285
+	100,	//286
+	99,	//287
+	99,	//288
+	100,	//289
+	100,	//290
+	99,	//291
+	99,	//292
+	100,	//293
+	100,	//294
+	99,	//295
+	99,	//296
+	100,	//297
+	100,	//298
+	99,	//299
+	99,	//300
+	100,	//301
+	100,	//302
+	99,	//303
+	99,	//304
+	100,	//305
+	100,	//306
+	99,	//307
+	99,	//308
+	100,	//309
+	100,	//310
+	99,	//311
+	99,	//312
+	100,	//313
+	100,	//314
+	99,	//315
+	99,	//316
+	100,	//317
+	100,	//318
+	99,	//319
+	99,	//320
+	100,	//321
+	100,	//322
+	99,	//323
+	99,	//324
+	100,	//325
+	100,	//326
+	99,	//327
+	99,	//328
+	100,	//329
+	100,	//330
+	99,	//331
+	99,	//332
+	100,	//333
+	100,	//334
+	99,	//335
+	99,	//336
+	100,	//337
+	100,	//338
+	99,	//339
+	99,	//340
+	100,	//341
+	100,	//342
+	99,	//343
+	99,	//344
+	100,	//345
+	100,	//346
+	99,	//347
+	99,	//348
+	100,	//349
+	100,	//350
+	99,	//351
+	99,	//352
+	100,	//353
+	101,	//354
+	99,	//355
+	99,	//356
+	101,	//357
+	101,	//358
+	99,	//359
+	98,	//360
+	101,	//361
+	101,	//362
+	98,	//363
+	98,	//364
+	101,	//365
+	101,	//366
+	98,	//367
+	98,	//368
+	102,	//369
+	102,	//370
+	97,	//371
+	97,	//372
+	102,	//373
+	103,	//374
+	96,	//375
+	96,	//376
+	104,	//377
+	105,	//378
+	93,	//379
+	92,	//380
+	113,	//381
+	113,	//382
+	51,	//383
+	-49,	//384
+	-112,	//385
+	-112,	//386
+	-90,	//387
+	-91,	//388
+	-104,	//389
+	-103,	//390
+	-94,	//391
+	-94,	//392
+	-102,	//393
+	-101,	//394
+	-95,	//395
+	-95,	//396
+	-101,	//397
+	-100,	//398
+	-96,	//399
+	-96,	//400
+	-100,	//401
+	-100,	//402
+	-96,	//403
+	-97,	//404
+	-100,	//405
+	-99,	//406
+	-96,	//407
+	-97,	//408
+	-100,	//409
+	-99,	//410
+	-96,	//411
+	-97,	//412
+	-100,	//413
+	-99,	//414
+	-97,	//415
+	-97,	//416
+	-99,	//417
+	-99,	//418
+	-97,	//419
+	-97,	//420
+	-99,	//421
+	-99,	//422
+	-97,	//423
+	-97,	//424
+	-99,	//425
+	-99,	//426
+	-97,	//427
+	-97,	//428
+	-99,	//429
+	-99,	//430
+	-97,	//431
+	-97,	//432
+	-99,	//433
+	-99,	//434
+	-97,	//435
+	-98,	//436
+	-99,	//437
+	-99,	//438
+	-97,	//439
+	-98,	//440
+	-99,	//441
+	-98,	//442
+	-97,	//443
+	-98,	//444
+	-99,	//445
+	-98,	//446
+	-97,	//447
+	-98,	//448
+	-99,	//449
+	-98,	//450
+	-97,	//451
+	-98,	//452
+	-99,	//453
+	-98,	//454
+	-97,	//455
+	-98,	//456
+	-99,	//457
+	-98,	//458
+	-97,	//459
+	-98,	//460
+	-99,	//461
+	-98,	//462
+	-97,	//463
+	-98,	//464
+	-99,	//465
+	-98,	//466
+	-97,	//467
+	-98,	//468
+	-99,	//469
+	-98,	//470
+	-97,	//471
+	-98,	//472
+	-99,	//473
+	-98,	//474
+	-97,	//475
+	-98,	//476
+	-99,	//477
+	-98,	//478
+	-97,	//479
+	-98,	//480
+	-100,	//481
+	-98,	//482
+	-96,	//483
+	-98,	//484
+	-100,	//485
+	-98,	//486
+	-96,	//487
+	-98,	//488
+	-100,	//489
+	-98,	//490
+	-96,	//491
+	-98,	//492
+	-100,	//493
+	-98,	//494
+	-96,	//495
+	-98,	//496
+	-101,	//497
+	-98,	//498
+	-95,	//499
+	-98,	//500
+	-102,	//501
+	-98,	//502
+	-94,	//503
+	-99,	//504
+	-104,	//505
+	-97,	//506
+	-90,	//507
+	-101,	//508
+	-112,	//509
+	-81,	//510
+	0,	//511
+	// level 2 - 32 harmonics
+	48,	//512
+	85,	//513
+	108,	//514
+	116,	//515
+	112,	//516
+	102,	//517
+	94,	//518
+	91,	//519
+	93,	//520
+	99,	//521
+	104,	//522
+	106,	//523
+	104,	//524
+	100,	//525
+	97,	//526
+	95,	//527
+	96,	//528
+	99,	//529
+	102,	//530
+	103,	//531
+	102,	//532
+	100,	//533
+	98,	//534
+	97,	//535
+	97,	//536
+	99,	//537
+	101,	//538
+	102,	//539
+	102,	//540
+	100,	//541
+	98,	//542
+	97,	//543
+	98,	//544
+	99,	//545
+	101,	//546
+	102,	//547
+	101,	//548
+	100,	//549
+	98,	//550
+	98,	//551
+	98,	//552
+	99,	//553
+	101,	//554
+	101,	//555
+	101,	//556
+	100,	//557
+	99,	//558
+	98,	//559
+	98,	//560
+	99,	//561
+	101,	//562
+	101,	//563
+	101,	//564
+	100,	//565
+	99,	//566
+	98,	//567
+	98,	//568
+	99,	//569
+	100,	//570
+	101,	//571
+	101,	//572
+	100,	//573
+	99,	//574
+	98,	//575
+	98,	//576
+	99,	//577
+	100,	//578
+	101,	//579
+	101,	//580
+	100,	//581
+	99,	//582
+	98,	//583
+	98,	//584
+	99,	//585
+	100,	//586
+	101,	//587
+	101,	//588
+	100,	//589
+	99,	//590
+	98,	//591
+	98,	//592
+	99,	//593
+	100,	//594
+	101,	//595
+	101,	//596
+	100,	//597
+	99,	//598
+	98,	//599
+	98,	//600
+	99,	//601
+	101,	//602
+	102,	//603
+	102,	//604
+	100,	//605
+	99,	//606
+	97,	//607
+	97,	//608
+	99,	//609
+	101,	//610
+	102,	//611
+	102,	//612
+	101,	//613
+	98,	//614
+	97,	//615
+	97,	//616
+	98,	//617
+	101,	//618
+	103,	//619
+	103,	//620
+	101,	//621
+	98,	//622
+	95,	//623
+	95,	//624
+	98,	//625
+	102,	//626
+	106,	//627
+	106,	//628
+	102,	//629
+	96,	//630
+	91,	//631
+	91,	//632
+	97,	//633
+	107,	//634
+	116,	//635
+	116,	//636
+	101,	//637
+	70,	//638
+	26,	//639
+	-24,	//640
+	-68,	//641
+	-100,	//642
+	-115,	//643
+	-115,	//644
+	-106,	//645
+	-95,	//646
+	-89,	//647
+	-89,	//648
+	-94,	//649
+	-101,	//650
+	-105,	//651
+	-105,	//652
+	-101,	//653
+	-96,	//654
+	-93,	//655
+	-93,	//656
+	-96,	//657
+	-100,	//658
+	-102,	//659
+	-102,	//660
+	-100,	//661
+	-96,	//662
+	-94,	//663
+	-95,	//664
+	-97,	//665
+	-100,	//666
+	-101,	//667
+	-101,	//668
+	-99,	//669
+	-97,	//670
+	-95,	//671
+	-95,	//672
+	-97,	//673
+	-99,	//674
+	-101,	//675
+	-101,	//676
+	-99,	//677
+	-97,	//678
+	-95,	//679
+	-96,	//680
+	-97,	//681
+	-99,	//682
+	-101,	//683
+	-100,	//684
+	-99,	//685
+	-97,	//686
+	-96,	//687
+	-96,	//688
+	-97,	//689
+	-99,	//690
+	-100,	//691
+	-100,	//692
+	-99,	//693
+	-97,	//694
+	-96,	//695
+	-96,	//696
+	-98,	//697
+	-99,	//698
+	-100,	//699
+	-100,	//700
+	-98,	//701
+	-97,	//702
+	-96,	//703
+	-96,	//704
+	-98,	//705
+	-99,	//706
+	-100,	//707
+	-100,	//708
+	-98,	//709
+	-97,	//710
+	-96,	//711
+	-96,	//712
+	-98,	//713
+	-99,	//714
+	-100,	//715
+	-100,	//716
+	-98,	//717
+	-97,	//718
+	-96,	//719
+	-96,	//720
+	-98,	//721
+	-100,	//722
+	-101,	//723
+	-100,	//724
+	-98,	//725
+	-96,	//726
+	-95,	//727
+	-96,	//728
+	-98,	//729
+	-100,	//730
+	-101,	//731
+	-100,	//732
+	-98,	//733
+	-96,	//734
+	-95,	//735
+	-96,	//736
+	-98,	//737
+	-100,	//738
+	-101,	//739
+	-100,	//740
+	-98,	//741
+	-95,	//742
+	-94,	//743
+	-95,	//744
+	-98,	//745
+	-101,	//746
+	-102,	//747
+	-101,	//748
+	-98,	//749
+	-94,	//750
+	-93,	//751
+	-94,	//752
+	-98,	//753
+	-103,	//754
+	-105,	//755
+	-103,	//756
+	-97,	//757
+	-91,	//758
+	-89,	//759
+	-92,	//760
+	-100,	//761
+	-110,	//762
+	-115,	//763
+	-108,	//764
+	-84,	//765
+	-46,	//766
+	1,	//767
+	// level 3 - 16 harmonics
+	25,	//768
+	48,	//769
+	69,	//770
+	87,	//771
+	100,	//772
+	110,	//773
+	115,	//774
+	117,	//775
+	116,	//776
+	112,	//777
+	107,	//778
+	102,	//779
+	97,	//780
+	93,	//781
+	91,	//782
+	90,	//783
+	91,	//784
+	93,	//785
+	96,	//786
+	99,	//787
+	102,	//788
+	104,	//789
+	106,	//790
+	106,	//791
+	106,	//792
+	104,	//793
+	102,	//794
+	100,	//795
+	98,	//796
+	96,	//797
+	95,	//798
+	95,	//799
+	95,	//800
+	96,	//801
+	97,	//802
+	99,	//803
+	101,	//804
+	102,	//805
+	103,	//806
+	104,	//807
+	104,	//808
+	103,	//809
+	102,	//810
+	100,	//811
+	98,	//812
+	97,	//813
+	96,	//814
+	96,	//815
+	96,	//816
+	97,	//817
+	98,	//818
+	99,	//819
+	101,	//820
+	102,	//821
+	103,	//822
+	103,	//823
+	103,	//824
+	102,	//825
+	101,	//826
+	100,	//827
+	99,	//828
+	97,	//829
+	97,	//830
+	96,	//831
+	96,	//832
+	97,	//833
+	98,	//834
+	99,	//835
+	101,	//836
+	102,	//837
+	103,	//838
+	103,	//839
+	103,	//840
+	102,	//841
+	101,	//842
+	100,	//843
+	99,	//844
+	97,	//845
+	96,	//846
+	96,	//847
+	96,	//848
+	97,	//849
+	98,	//850
+	99,	//851
+	101,	//852
+	102,	//853
+	103,	//854
+	104,	//855
+	104,	//856
+	103,	//857
+	102,	//858
+	100,	//859
+	98,	//860
+	97,	//861
+	95,	//862
+	95,	//863
+	95,	//864
+	95,	//865
+	97,	//866
+	99,	//867
+	101,	//868
+	103,	//869
+	105,	//870
+	106,	//871
+	106,	//872
+	105,	//873
+	103,	//874
+	100,	//875
+	97,	//876
+	94,	//877
+	92,	//878
+	90,	//879
+	90,	//880
+	92,	//881
+	95,	//882
+	99,	//883
+	105,	//884
+	110,	//885
+	114,	//886
+	117,	//887
+	117,	//888
+	113,	//889
+	106,	//890
+	95,	//891
+	79,	//892
+	60,	//893
+	38,	//894
+	14,	//895
+	-11,	//896
+	-35,	//897
+	-58,	//898
+	-77,	//899
+	-93,	//900
+	-105,	//901
+	-113,	//902
+	-116,	//903
+	-116,	//904
+	-113,	//905
+	-109,	//906
+	-103,	//907
+	-98,	//908
+	-93,	//909
+	-90,	//910
+	-88,	//911
+	-88,	//912
+	-90,	//913
+	-92,	//914
+	-96,	//915
+	-99,	//916
+	-102,	//917
+	-104,	//918
+	-105,	//919
+	-105,	//920
+	-104,	//921
+	-102,	//922
+	-100,	//923
+	-97,	//924
+	-95,	//925
+	-93,	//926
+	-92,	//927
+	-92,	//928
+	-93,	//929
+	-95,	//930
+	-97,	//931
+	-99,	//932
+	-101,	//933
+	-102,	//934
+	-103,	//935
+	-103,	//936
+	-102,	//937
+	-101,	//938
+	-99,	//939
+	-97,	//940
+	-95,	//941
+	-94,	//942
+	-93,	//943
+	-94,	//944
+	-94,	//945
+	-96,	//946
+	-97,	//947
+	-99,	//948
+	-101,	//949
+	-102,	//950
+	-102,	//951
+	-102,	//952
+	-101,	//953
+	-100,	//954
+	-99,	//955
+	-97,	//956
+	-95,	//957
+	-94,	//958
+	-94,	//959
+	-94,	//960
+	-95,	//961
+	-96,	//962
+	-98,	//963
+	-99,	//964
+	-101,	//965
+	-102,	//966
+	-102,	//967
+	-102,	//968
+	-101,	//969
+	-100,	//970
+	-98,	//971
+	-97,	//972
+	-95,	//973
+	-94,	//974
+	-93,	//975
+	-94,	//976
+	-95,	//977
+	-96,	//978
+	-98,	//979
+	-100,	//980
+	-101,	//981
+	-103,	//982
+	-103,	//983
+	-103,	//984
+	-102,	//985
+	-100,	//986
+	-98,	//987
+	-96,	//988
+	-94,	//989
+	-93,	//990
+	-92,	//991
+	-93,	//992
+	-94,	//993
+	-96,	//994
+	-98,	//995
+	-101,	//996
+	-103,	//997
+	-105,	//998
+	-105,	//999
+	-105,	//1000
+	-103,	//1001
+	-100,	//1002
+	-97,	//1003
+	-94,	//1004
+	-91,	//1005
+	-89,	//1006
+	-88,	//1007
+	-89,	//1008
+	-91,	//1009
+	-95,	//1010
+	-100,	//1011
+	-106,	//1012
+	-111,	//1013
+	-115,	//1014
+	-116,	//1015
+	-114,	//1016
+	-109,	//1017
+	-99,	//1018
+	-85,	//1019
+	-68,	//1020
+	-47,	//1021
+	-23,	//1022
+	1,	//1023
+	// level 4 - 8 harmonics
+	13,	//1024
+	26,	//1025
+	37,	//1026
+	49,	//1027
+	59,	//1028
+	69,	//1029
+	79,	//1030
+	87,	//1031
+	94,	//1032
+	101,	//1033
+	106,	//1034
+	110,	//1035
+	113,	//1036
+	116,	//1037
+	117,	//1038
+	117,	//1039
+	117,	//1040
+	116,	//1041
+	114,	//1042
+	112,	//1043
+	110,	//1044
+	107,	//1045
+	105,	//1046
+	102,	//1047
+	99,	//1048
+	97,	//1049
+	95,	//1050
+	93,	//1051
+	91,	//1052
+	90,	//1053
+	90,	//1054
+	89,	//1055
+	90,	//1056
+	90,	//1057
+	91,	//1058
+	92,	//1059
+	94,	//1060
+	95,	//1061
+	97,	//1062
+	99,	//1063
+	100,	//1064
+	102,	//1065
+	104,	//1066
+	105,	//1067
+	106,	//1068
+	107,	//1069
+	107,	//1070
+	108,	//1071
+	107,	//1072
+	107,	//1073
+	106,	//1074
+	105,	//1075
+	104,	//1076
+	103,	//1077
+	102,	//1078
+	100,	//1079
+	99,	//1080
+	97,	//1081
+	96,	//1082
+	95,	//1083
+	94,	//1084
+	93,	//1085
+	92,	//1086
+	92,	//1087
+	92,	//1088
+	93,	//1089
+	93,	//1090
+	94,	//1091
+	95,	//1092
+	96,	//1093
+	98,	//1094
+	99,	//1095
+	101,	//1096
+	102,	//1097
+	104,	//1098
+	105,	//1099
+	106,	//1100
+	107,	//1101
+	107,	//1102
+	108,	//1103
+	108,	//1104
+	107,	//1105
+	107,	//1106
+	106,	//1107
+	104,	//1108
+	103,	//1109
+	101,	//1110
+	100,	//1111
+	98,	//1112
+	96,	//1113
+	94,	//1114
+	93,	//1115
+	92,	//1116
+	90,	//1117
+	90,	//1118
+	89,	//1119
+	89,	//1120
+	90,	//1121
+	91,	//1122
+	92,	//1123
+	94,	//1124
+	96,	//1125
+	98,	//1126
+	101,	//1127
+	103,	//1128
+	106,	//1129
+	109,	//1130
+	111,	//1131
+	113,	//1132
+	115,	//1133
+	117,	//1134
+	117,	//1135
+	117,	//1136
+	117,	//1137
+	115,	//1138
+	112,	//1139
+	108,	//1140
+	104,	//1141
+	98,	//1142
+	91,	//1143
+	83,	//1144
+	74,	//1145
+	65,	//1146
+	54,	//1147
+	43,	//1148
+	32,	//1149
+	20,	//1150
+	7,	//1151
+	-5,	//1152
+	-17,	//1153
+	-29,	//1154
+	-41,	//1155
+	-52,	//1156
+	-63,	//1157
+	-73,	//1158
+	-82,	//1159
+	-90,	//1160
+	-97,	//1161
+	-103,	//1162
+	-107,	//1163
+	-111,	//1164
+	-114,	//1165
+	-116,	//1166
+	-117,	//1167
+	-117,	//1168
+	-116,	//1169
+	-114,	//1170
+	-112,	//1171
+	-110,	//1172
+	-107,	//1173
+	-104,	//1174
+	-102,	//1175
+	-99,	//1176
+	-96,	//1177
+	-94,	//1178
+	-91,	//1179
+	-90,	//1180
+	-88,	//1181
+	-87,	//1182
+	-87,	//1183
+	-87,	//1184
+	-88,	//1185
+	-88,	//1186
+	-90,	//1187
+	-91,	//1188
+	-93,	//1189
+	-95,	//1190
+	-97,	//1191
+	-99,	//1192
+	-100,	//1193
+	-102,	//1194
+	-104,	//1195
+	-105,	//1196
+	-106,	//1197
+	-106,	//1198
+	-107,	//1199
+	-107,	//1200
+	-106,	//1201
+	-106,	//1202
+	-105,	//1203
+	-103,	//1204
+	-102,	//1205
+	-100,	//1206
+	-99,	//1207
+	-97,	//1208
+	-95,	//1209
+	-94,	//1210
+	-93,	//1211
+	-92,	//1212
+	-91,	//1213
+	-90,	//1214
+	-90,	//1215
+	-90,	//1216
+	-90,	//1217
+	-91,	//1218
+	-92,	//1219
+	-93,	//1220
+	-95,	//1221
+	-96,	//1222
+	-98,	//1223
+	-100,	//1224
+	-101,	//1225
+	-103,	//1226
+	-104,	//1227
+	-105,	//1228
+	-106,	//1229
+	-107,	//1230
+	-107,	//1231
+	-107,	//1232
+	-106,	//1233
+	-105,	//1234
+	-104,	//1235
+	-103,	//1236
+	-101,	//1237
+	-99,	//1238
+	-98,	//1239
+	-96,	//1240
+	-94,	//1241
+	-92,	//1242
+	-90,	//1243
+	-89,	//1244
+	-88,	//1245
+	-87,	//1246
+	-87,	//1247
+	-87,	//1248
+	-88,	//1249
+	-89,	//1250
+	-91,	//1251
+	-92,	//1252
+	-95,	//1253
+	-97,	//1254
+	-100,	//1255
+	-103,	//1256
+	-106,	//1257
+	-109,	//1258
+	-111,	//1259
+	-113,	//1260
+	-115,	//1261
+	-116,	//1262
+	-117,	//1263
+	-116,	//1264
+	-115,	//1265
+	-113,	//1266
+	-109,	//1267
+	-105,	//1268
+	-100,	//1269
+	-93,	//1270
+	-86,	//1271
+	-77,	//1272
+	-68,	//1273
+	-58,	//1274
+	-47,	//1275
+	-35,	//1276
+	-23,	//1277
+	-11,	//1278
+	1,	//1279
+	// level 5 - 4 harmonics
+	7,	//1280
+	13,	//1281
+	20,	//1282
+	26,	//1283
+	32,	//1284
+	37,	//1285
+	43,	//1286
+	49,	//1287
+	54,	//1288
+	60,	//1289
+	65,	//1290
+	70,	//1291
+	75,	//1292
+	79,	//1293
+	83,	//1294
+	88,	//1295
+	91,	//1296
+	95,	//1297
+	98,	//1298
+	102,	//1299
+	104,	//1300
+	107,	//1301
+	109,	//1302
+	111,	//1303
+	113,	//1304
+	115,	//1305
+	116,	//1306
+	117,	//1307
+	118,	//1308
+	119,	//1309
+	119,	//1310
+	119,	//1311
+	119,	//1312
+	119,	//1313
+	118,	//1314
+	118,	//1315
+	117,	//1316
+	116,	//1317
+	115,	//1318
+	113,	//1319
+	112,	//1320
+	111,	//1321
+	109,	//1322
+	108,	//1323
+	106,	//1324
+	105,	//1325
+	103,	//1326
+	101,	//1327
+	100,	//1328
+	98,	//1329
+	97,	//1330
+	95,	//1331
+	94,	//1332
+	92,	//1333
+	91,	//1334
+	90,	//1335
+	89,	//1336
+	88,	//1337
+	87,	//1338
+	86,	//1339
+	86,	//1340
+	85,	//1341
+	85,	//1342
+	85,	//1343
+	85,	//1344
+	85,	//1345
+	86,	//1346
+	86,	//1347
+	87,	//1348
+	87,	//1349
+	88,	//1350
+	89,	//1351
+	90,	//1352
+	92,	//1353
+	93,	//1354
+	94,	//1355
+	96,	//1356
+	97,	//1357
+	99,	//1358
+	100,	//1359
+	102,	//1360
+	104,	//1361
+	105,	//1362
+	107,	//1363
+	108,	//1364
+	110,	//1365
+	111,	//1366
+	113,	//1367
+	114,	//1368
+	115,	//1369
+	116,	//1370
+	117,	//1371
+	118,	//1372
+	118,	//1373
+	119,	//1374
+	119,	//1375
+	119,	//1376
+	119,	//1377
+	118,	//1378
+	118,	//1379
+	117,	//1380
+	116,	//1381
+	114,	//1382
+	112,	//1383
+	111,	//1384
+	108,	//1385
+	106,	//1386
+	103,	//1387
+	100,	//1388
+	97,	//1389
+	93,	//1390
+	90,	//1391
+	86,	//1392
+	81,	//1393
+	77,	//1394
+	72,	//1395
+	67,	//1396
+	62,	//1397
+	57,	//1398
+	52,	//1399
+	46,	//1400
+	40,	//1401
+	35,	//1402
+	29,	//1403
+	23,	//1404
+	17,	//1405
+	10,	//1406
+	4,	//1407
+	-2,	//1408
+	-8,	//1409
+	-14,	//1410
+	-20,	//1411
+	-26,	//1412
+	-32,	//1413
+	-38,	//1414
+	-44,	//1415
+	-50,	//1416
+	-55,	//1417
+	-60,	//1418
+	-66,	//1419
+	-71,	//1420
+	-75,	//1421
+	-80,	//1422
+	-84,	//1423
+	-88,	//1424
+	-92,	//1425
+	-96,	//1426
+	-99,	//1427
+	-102,	//1428
+	-105,	//1429
+	-107,	//1430
+	-110,	//1431
+	-112,	//1432
+	-113,	//1433
+	-115,	//1434
+	-116,	//1435
+	-117,	//1436
+	-118,	//1437
+	-118,	//1438
+	-118,	//1439
+	-118,	//1440
+	-118,	//1441
+	-118,	//1442
+	-117,	//1443
+	-116,	//1444
+	-115,	//1445
+	-114,	//1446
+	-113,	//1447
+	-111,	//1448
+	-110,	//1449
+	-108,	//1450
+	-107,	//1451
+	-105,	//1452
+	-103,	//1453
+	-102,	//1454
+	-100,	//1455
+	-98,	//1456
+	-97,	//1457
+	-95,	//1458
+	-93,	//1459
+	-92,	//1460
+	-90,	//1461
+	-89,	//1462
+	-88,	//1463
+	-87,	//1464
+	-86,	//1465
+	-85,	//1466
+	-84,	//1467
+	-84,	//1468
+	-83,	//1469
+	-83,	//1470
+	-83,	//1471
+	-83,	//1472
+	-83,	//1473
+	-83,	//1474
+	-84,	//1475
+	-84,	//1476
+	-85,	//1477
+	-86,	//1478
+	-87,	//1479
+	-88,	//1480
+	-90,	//1481
+	-91,	//1482
+	-93,	//1483
+	-94,	//1484
+	-96,	//1485
+	-97,	//1486
+	-99,	//1487
+	-101,	//1488
+	-103,	//1489
+	-104,	//1490
+	-106,	//1491
+	-108,	//1492
+	-109,	//1493
+	-111,	//1494
+	-112,	//1495
+	-113,	//1496
+	-115,	//1497
+	-116,	//1498
+	-117,	//1499
+	-117,	//1500
+	-118,	//1501
+	-118,	//1502
+	-118,	//1503
+	-118,	//1504
+	-118,	//1505
+	-117,	//1506
+	-116,	//1507
+	-115,	//1508
+	-114,	//1509
+	-112,	//1510
+	-111,	//1511
+	-108,	//1512
+	-106,	//1513
+	-103,	//1514
+	-101,	//1515
+	-97,	//1516
+	-94,	//1517
+	-90,	//1518
+	-86,	//1519
+	-82,	//1520
+	-78,	//1521
+	-73,	//1522
+	-68,	//1523
+	-63,	//1524
+	-58,	//1525
+	-52,	//1526
+	-47,	//1527
+	-41,	//1528
+	-35,	//1529
+	-29,	//1530
+	-23,	//1531
+	-17,	//1532
+	-11,	//1533
+	-5,	//1534
+	1,	//1535
+	// level 6 - 2 harmonics
+	4,	//1536
+	7,	//1537
+	10,	//1538
+	13,	//1539
+	17,	//1540
+	20,	//1541
+	23,	//1542
+	26,	//1543
+	29,	//1544
+	32,	//1545
+	35,	//1546
+	38,	//1547
+	41,	//1548
+	43,	//1549
+	46,	//1550
+	49,	//1551
+	52,	//1552
+	55,	//1553
+	57,	//1554
+	60,	//1555
+	63,	//1556
+	66,	//1557
+	68,	//1558
+	71,	//1559
+	73,	//1560
+	76,	//1561
+	78,	//1562
+	81,	//1563
+	83,	//1564
+	85,	//1565
+	87,	//1566
+	90,	//1567
+	92,	//1568
+	94,	//1569
+	96,	//1570
+	98,	//1571
+	100,	//1572
+	102,	//1573
+	103,	//1574
+	105,	//1575
+	107,	//1576
+	108,	//1577
+	110,	//1578
+	111,	//1579
+	113,	//1580
+	114,	//1581
+	115,	//1582
+	117,	//1583
+	118,	//1584
+	119,	//1585
+	120,	//1586
+	121,	//1587
+	122,	//1588
+	122,	//1589
+	123,	//1590
+	124,	//1591
+	124,	//1592
+	125,	//1593
+	125,	//1594
+	126,	//1595
+	126,	//1596
+	126,	//1597
+	126,	//1598
+	126,	//1599
+	126,	//1600
+	126,	//1601
+	126,	//1602
+	126,	//1603
+	125,	//1604
+	125,	//1605
+	125,	//1606
+	124,	//1607
+	123,	//1608
+	123,	//1609
+	122,	//1610
+	121,	//1611
+	120,	//1612
+	119,	//1613
+	118,	//1614
+	117,	//1615
+	116,	//1616
+	115,	//1617
+	113,	//1618
+	112,	//1619
+	111,	//1620
+	109,	//1621
+	108,	//1622
+	106,	//1623
+	104,	//1624
+	102,	//1625
+	101,	//1626
+	99,	//1627
+	97,	//1628
+	95,	//1629
+	93,	//1630
+	91,	//1631
+	89,	//1632
+	86,	//1633
+	84,	//1634
+	82,	//1635
+	79,	//1636
+	77,	//1637
+	75,	//1638
+	72,	//1639
+	69,	//1640
+	67,	//1641
+	64,	//1642
+	62,	//1643
+	59,	//1644
+	56,	//1645
+	53,	//1646
+	51,	//1647
+	48,	//1648
+	45,	//1649
+	42,	//1650
+	39,	//1651
+	36,	//1652
+	33,	//1653
+	30,	//1654
+	27,	//1655
+	24,	//1656
+	21,	//1657
+	18,	//1658
+	15,	//1659
+	12,	//1660
+	9,	//1661
+	6,	//1662
+	3,	//1663
+	0,	//1664
+	-3,	//1665
+	-7,	//1666
+	-10,	//1667
+	-13,	//1668
+	-16,	//1669
+	-19,	//1670
+	-22,	//1671
+	-25,	//1672
+	-28,	//1673
+	-31,	//1674
+	-34,	//1675
+	-37,	//1676
+	-40,	//1677
+	-43,	//1678
+	-46,	//1679
+	-49,	//1680
+	-51,	//1681
+	-54,	//1682
+	-57,	//1683
+	-60,	//1684
+	-62,	//1685
+	-65,	//1686
+	-68,	//1687
+	-70,	//1688
+	-73,	//1689
+	-75,	//1690
+	-78,	//1691
+	-80,	//1692
+	-83,	//1693
+	-85,	//1694
+	-87,	//1695
+	-89,	//1696
+	-92,	//1697
+	-94,	//1698
+	-96,	//1699
+	-98,	//1700
+	-100,	//1701
+	-102,	//1702
+	-103,	//1703
+	-105,	//1704
+	-107,	//1705
+	-108,	//1706
+	-110,	//1707
+	-111,	//1708
+	-113,	//1709
+	-114,	//1710
+	-115,	//1711
+	-117,	//1712
+	-118,	//1713
+	-119,	//1714
+	-120,	//1715
+	-121,	//1716
+	-121,	//1717
+	-122,	//1718
+	-123,	//1719
+	-123,	//1720
+	-124,	//1721
+	-124,	//1722
+	-125,	//1723
+	-125,	//1724
+	-125,	//1725
+	-125,	//1726
+	-125,	//1727
+	-125,	//1728
+	-125,	//1729
+	-125,	//1730
+	-125,	//1731
+	-125,	//1732
+	-124,	//1733
+	-124,	//1734
+	-123,	//1735
+	-122,	//1736
+	-122,	//1737
+	-121,	//1738
+	-120,	//1739
+	-119,	//1740
+	-118,	//1741
+	-117,	//1742
+	-116,	//1743
+	-115,	//1744
+	-113,	//1745
+	-112,	//1746
+	-111,	//1747
+	-109,	//1748
+	-108,	//1749
+	-106,	//1750
+	-104,	//1751
+	-102,	//1752
+	-101,	//1753
+	-99,	//1754
+	-97,	//1755
+	-95,	//1756
+	-93,	//1757
+	-91,	//1758
+	-88,	//1759
+	-86,	//1760
+	-84,	//1761
+	-82,	//1762
+	-79,	//1763
+	-77,	//1764
+	-74,	//1765
+	-72,	//1766
+	-69,	//1767
+	-66,	//1768
+	-64,	//1769
+	-61,	//1770
+	-58,	//1771
+	-56,	//1772
+	-53,	//1773
+	-50,	//1774
+	-47,	//1775
+	-44,	//1776
+	-41,	//1777
+	-38,	//1778
+	-35,	//1779
+	-33,	//1780
+	-30,	//1781
+	-26,	//1782
+	-23,	//1783
+	-20,	//1784
+	-17,	//1785
+	-14,	//1786
+	-11,	//1787
+	-8,	//1788
+	-5,	//1789
+	-2,	//1790
+	1,	//1791
+	// level 7 - 1 harmonics
+	3,	//1792
+	7,	//1793
+	10,	//1794
+	13,	//1795
+	16,	//1796
+	19,	//1797
+	22,	//1798
+	25,	//1799
+	28,	//1800
+	31,	//1801
+	34,	//1802
+	37,	//1803
+	40,	//1804
+	43,	//1805
+	46,	//1806
+	49,	//1807
+	51,	//1808
+	54,	//1809
+	57,	//1810
+	60,	//1811
+	63,	//1812
+	65,	//1813
+	68,	//1814
+	70,	//1815
+	73,	//1816
+	75,	//1817
+	78,	//1818
+	80,	//1819
+	83,	//1820
+	85,	//1821
+	87,	//1822
+	90,	//1823
+	92,	//1824
+	94,	//1825
+	96,	//1826
+	98,	//1827
+	100,	//1828
+	102,	//1829
+	104,	//1830
+	105,	//1831
+	107,	//1832
+	109,	//1833
+	110,	//1834
+	112,	//1835
+	113,	//1836
+	115,	//1837
+	116,	//1838
+	117,	//1839
+	118,	//1840
+	119,	//1841
+	120,	//1842
+	121,	//1843
+	122,	//1844
+	123,	//1845
+	124,	//1846
+	124,	//1847
+	125,	//1848
+	126,	//1849
+	126,	//1850
+	126,	//1851
+	127,	//1852
+	127,	//1853
+	127,	//1854
+	127,	//1855
+	127,	//1856
+	127,	//1857
+	127,	//1858
+	126,	//1859
+	126,	//1860
+	126,	//1861
+	125,	//1862
+	125,	//1863
+	124,	//1864
+	123,	//1865
+	123,	//1866
+	122,	//1867
+	121,	//1868
+	120,	//1869
+	119,	//1870
+	118,	//1871
+	117,	//1872
+	115,	//1873
+	114,	//1874
+	113,	//1875
+	111,	//1876
+	110,	//1877
+	108,	//1878
+	106,	//1879
+	104,	//1880
+	103,	//1881
+	101,	//1882
+	99,	//1883
+	97,	//1884
+	95,	//1885
+	93,	//1886
+	91,	//1887
+	89,	//1888
+	86,	//1889
+	84,	//1890
+	82,	//1891
+	79,	//1892
+	77,	//1893
+	74,	//1894
+	72,	//1895
+	69,	//1896
+	67,	//1897
+	64,	//1898
+	61,	//1899
+	58,	//1900
+	56,	//1901
+	53,	//1902
+	50,	//1903
+	47,	//1904
+	44,	//1905
+	41,	//1906
+	38,	//1907
+	35,	//1908
+	33,	//1909
+	30,	//1910
+	26,	//1911
+	23,	//1912
+	20,	//1913
+	17,	//1914
+	14,	//1915
+	11,	//1916
+	8,	//1917
+	5,	//1918
+	2,	//1919
+	-1,	//1920
+	-4,	//1921
+	-7,	//1922
+	-10,	//1923
+	-13,	//1924
+	-17,	//1925
+	-20,	//1926
+	-23,	//1927
+	-26,	//1928
+	-29,	//1929
+	-32,	//1930
+	-35,	//1931
+	-38,	//1932
+	-40,	//1933
+	-43,	//1934
+	-46,	//1935
+	-49,	//1936
+	-52,	//1937
+	-55,	//1938
+	-57,	//1939
+	-60,	//1940
+	-63,	//1941
+	-65,	//1942
+	-68,	//1943
+	-71,	//1944
+	-73,	//1945
+	-76,	//1946
+	-78,	//1947
+	-80,	//1948
+	-83,	//1949
+	-85,	//1950
+	-87,	//1951
+	-89,	//1952
+	-92,	//1953
+	-94,	//1954
+	-96,	//1955
+	-98,	//1956
+	-99,	//1957
+	-101,	//1958
+	-103,	//1959
+	-105,	//1960
+	-106,	//1961
+	-108,	//1962
+	-109,	//1963
+	-111,	//1964
+	-112,	//1965
+	-114,	//1966
+	-115,	//1967
+	-116,	//1968
+	-117,	//1969
+	-118,	//1970
+	-119,	//1971
+	-120,	//1972
+	-121,	//1973
+	-121,	//1974
+	-122,	//1975
+	-123,	//1976
+	-123,	//1977
+	-124,	//1978
+	-124,	//1979
+	-124,	//1980
+	-124,	//1981
+	-125,	//1982
+	-125,	//1983
+	-125,	//1984
+	-125,	//1985
+	-124,	//1986
+	-124,	//1987
+	-124,	//1988
+	-123,	//1989
+	-123,	//1990
+	-122,	//1991
+	-122,	//1992
+	-121,	//1993
+	-120,	//1994
+	-119,	//1995
+	-119,	//1996
+	-118,	//1997
+	-117,	//1998
+	-115,	//1999
+	-114,	//2000
+	-113,	//2001
+	-112,	//2002
+	-110,	//2003
+	-109,	//2004
+	-107,	//2005
+	-106,	//2006
+	-104,	//2007
+	-102,	//2008
+	-100,	//2009
+	-99,	//2010
+	-97,	//2011
+	-95,	//2012
+	-93,	//2013
+	-91,	//2014
+	-88,	//2015
+	-86,	//2016
+	-84,	//2017
+	-82,	//2018
+	-79,	//2019
+	-77,	//2020
+	-74,	//2021
+	-72,	//2022
+	-69,	//2023
+	-67,	//2024
+	-64,	//2025
+	-62,	//2026
+	-59,	//2027
+	-56,	//2028
+	-53,	//2029
+	-51,	//2030
+	-48,	//2031
+	-45,	//2032
+	-42,	//2033
+	-39,	//2034
+	-36,	//2035
+	-33,	//2036
+	-30,	//2037
+	-27,	//2038
+	-24,	//2039
+	-21,	//2040
+	-18,	//2041
+	-15,	//2042
+	-12,	//2043
+	-9,	//2044
+	-6,	//2045
+	-3,	//2046
+	0,	//2047
+};
+
+#endif
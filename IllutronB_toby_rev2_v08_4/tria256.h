@@ -1,7 +1,7 @@
 #ifndef _TRIANGLE_
 #define _TRIANGLE_
 
-PROGMEM char TriangleTable[]=
+PROGMEM const signed char TriangleTable[]=
 {
 	0,	//0
 	1,	//1